@@ -0,0 +1,338 @@
+// ---------------------------------------------------------- //
+// Micro benchmarks of the engine's hot paths
+// run it from the bin folder (it needs the assets):
+//   ./mario_bench            - everything that doesn't need a display
+//   ./mario_bench --render   - also Render::drawAll into a sf::RenderTexture
+// ---------------------------------------------------------- //
+#include <SFML/Graphics.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../src/engine/components.hpp"
+#include "../src/engine/manager.hpp"
+#include "../src/engine/system.hpp"
+#include "../src/engine/textures.hpp"
+#include "../src/engine/jobs.hpp"
+#include "../src/engine/timers.hpp"
+#include "../src/entities/entities.hpp"
+#include "../src/entities/enemies.hpp"
+
+namespace Bench
+{
+    using Clock = std::chrono::steady_clock;
+
+    // ----------- State ------------ //
+    // while(state.keepRunning()) { ... } runs the body `iterations` times,
+    // only the loop is timed so the setup before it is not counted
+    class State
+    {
+    public:
+        explicit State(std::size_t iterations, long argument) noexcept
+            : m_remaining(iterations), m_argument(argument) {}
+
+        bool keepRunning() noexcept 
+        {
+            if(not m_started) 
+            {
+                m_started = true;
+                m_start = Clock::now();
+            }
+
+            if(m_remaining == 0) 
+            {
+                m_end = Clock::now();
+                return false;
+            }
+
+            m_remaining--;
+            return true;
+        }
+
+        long argument() const noexcept { return m_argument; }
+        Clock::duration elapsed() const noexcept { return m_end - m_start; }
+
+    private:
+        std::size_t m_remaining;
+        long m_argument;
+
+        bool m_started = false;
+        Clock::time_point m_start;
+        Clock::time_point m_end;
+    };
+
+    using Function = void(*)(State&);
+
+    struct Benchmark
+    {
+        std::string name;
+        Function function;
+        long argument;
+    };
+
+    std::vector<Benchmark>& registry()
+    {
+        static std::vector<Benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    bool add(const std::string& name, Function function, std::vector<long> arguments = { 0 })
+    {
+        for(const long argument : arguments) 
+        {
+            const std::string fullName = argument == 0 ? name : name + "/" + std::to_string(argument);
+            registry().push_back(Benchmark { fullName, function, argument });
+        }
+
+        return true;
+    }
+
+    // doubles the iterations until a run takes at least MIN_TIME
+    void run(const Benchmark& benchmark)
+    {
+        static constexpr std::chrono::milliseconds MIN_TIME(500);
+
+        std::size_t iterations = 1;
+        while(true)
+        {
+            State state(iterations, benchmark.argument);
+
+            benchmark.function(state);
+            const auto elapsed = state.elapsed();
+
+            if(elapsed >= MIN_TIME || iterations >= (std::size_t(1) << 30))
+            {
+                const double ns = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+                std::printf("%-36s %14.1f ns %12zu\n", benchmark.name.c_str(), ns, iterations);
+                return;
+            }
+
+            iterations *= 2;
+        }
+    }
+} // namespace Bench
+
+#define BENCHMARK(function, ...) \
+    static const bool function##Registered = Bench::add(#function, function, ##__VA_ARGS__)
+
+// ---------------------------------------------------------- //
+// ------------------------ Helpers ------------------------- //
+// ---------------------------------------------------------- //
+namespace 
+{
+    void clearWorld() noexcept
+    {
+        while(not Component::bases.empty()) {
+            Manager::remove(Component::bases.entityAt(0));
+        }
+    }
+
+    // a floor of blocks with goombas walking on top of it,
+    // one goomba for every ten entities
+    std::vector<EntityID> createLevel(long entities)
+    {
+        clearWorld();
+
+        std::vector<EntityID> goombas;
+        for(long i = 0; i < entities; i++)
+        {
+            const float x = 16.f * (i / 2);
+
+            if(i % 10 == 0) 
+            {
+                Enemy::Goomba::create(sf::Vector2f(x, 200));
+
+                // the bases are kept by archetype, the members of a type in creation order
+                const ComponentMemberSet& members = Component::typeMembers[std::size_t(Enum::Type::GOOMBA)];
+                goombas.push_back(members.entityAt(members.size() - 1));
+            }
+            else {
+                Entity::Block::create(sf::Vector2f(x, 220 + 16.f * (i % 2)), Enum::Block::EMPTY, std::nullopt);
+            }
+        }
+
+        return goombas;
+    }
+} // namespace
+
+// ---------------------------------------------------------- //
+// ---------------------- Benchmarks ------------------------ //
+// ---------------------------------------------------------- //
+void managerCreateRemove(Bench::State& state)
+{
+    clearWorld();
+
+    while(state.keepRunning()) {
+        Manager::remove(Manager::create("assets/block.png"));
+    }
+}
+BENCHMARK(managerCreateRemove);
+
+void checkIntersections(Bench::State& state)
+{
+    clearWorld();
+
+    Entity::Block::create(sf::Vector2f(100, 100), Enum::Block::EMPTY, std::nullopt);
+    Entity::Block::create(sf::Vector2f(108, 110), Enum::Block::EMPTY, std::nullopt);
+
+    const EntityID first  = Component::bases.entityAt(0);
+    const EntityID second = Component::bases.entityAt(1);
+
+    COLLISION collision = COLLISION::NONE;
+    while(state.keepRunning()) {
+        collision = System::Physics::Helper::checkIntersections(first, second);
+    }
+
+    if(collision == COLLISION::NONE) {
+        std::puts("checkIntersections: expected a collision!");
+    }
+}
+BENCHMARK(checkIntersections);
+
+// one frame of physics for every goomba of the level
+void physicsStart(Bench::State& state)
+{
+    const std::vector<EntityID> goombas = createLevel(state.argument());
+
+    while(state.keepRunning()) 
+    {
+        for(const EntityID id : goombas) {
+            System::Physics::start(id);
+        }
+    }
+}
+BENCHMARK(physicsStart, { 100, 1000, 10000 });
+
+// the same, but detecting the collisions on all of the threads
+void physicsStartAll(Bench::State& state)
+{
+    createLevel(state.argument());
+
+    while(state.keepRunning()) {
+        System::Physics::startAll();
+    }
+}
+BENCHMARK(physicsStartAll, { 100, 1000, 10000, 100000 });
+
+// the same level, but only a screen of it around the camera is simulated
+void physicsStartAllActive(Bench::State& state)
+{
+    createLevel(state.argument());
+    System::Activation::setRegion(sf::FloatRect(0, 0, 800, 600));
+
+    while(state.keepRunning()) 
+    {
+        System::Activation::update();
+        System::Physics::startAll();
+    }
+
+    System::Activation::clearRegion();
+}
+BENCHMARK(physicsStartAllActive, { 1000, 100000 });
+
+// walking every entity with both physics and movement
+void viewPhysicsMovement(Bench::State& state)
+{
+    createLevel(state.argument());
+
+    float speed = 0;
+    while(state.keepRunning()) 
+    {
+        Manager::view<Component::Physics, Component::Movement>().each(
+            [&speed](EntityID, Component::Physics& physics, Component::Movement& movement) 
+            {
+                if(not movement.isJumping) {
+                    speed += physics.speed;
+                }
+            });
+    }
+
+    if(speed == 0) {
+        std::puts("viewPhysicsMovement: nothing was visited!");
+    }
+}
+BENCHMARK(viewPhysicsMovement, { 1000, 100000 });
+
+void animationPlayAll(Bench::State& state)
+{
+    clearWorld();
+    for(long i = 0; i < state.argument(); i++) {
+        Entity::Coin::create(sf::Vector2f(16.f * (i % 1000), 16.f * (i / 1000)));
+    }
+
+    while(state.keepRunning()) {
+        System::Animation::playAll();
+    }
+}
+BENCHMARK(animationPlayAll, { 1000, 100000 });
+
+// every timer schedules itself again when it runs out
+void timersAdvance(Bench::State& state)
+{
+    static constexpr unsigned int period = 200;
+
+    clearWorld();
+    Entity::Coin::create(sf::Vector2f(0, 0));
+    const EntityID owner = Component::bases.entityAt(0);
+
+    static constexpr Timers::Callback again = [](EntityID id) {
+        Timers::schedule(id, period, again);
+    };
+
+    for(long i = 0; i < state.argument(); i++) {
+        Timers::schedule(owner, 1 + i % period, again);
+    }
+
+    while(state.keepRunning()) {
+        Timers::advance();
+    }
+
+    // the rest of them run out on an entity that is gone
+    clearWorld();
+}
+BENCHMARK(timersAdvance, { 1000, 100000 });
+
+// only with --render, needs a display for the OpenGL context
+void renderDrawAll(Bench::State& state)
+{
+    static sf::RenderTexture target;
+    static const bool created = target.create(800, 600);
+    if(not created) {
+        return;
+    }
+
+    static System::Render render(target);
+    createLevel(state.argument());
+
+    while(state.keepRunning()) 
+    {
+        target.clear();
+        render.drawAll();
+        target.display();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const bool withRender = argc > 1 && std::string_view(argv[1]) == "--render";
+    if(withRender) {
+        Bench::add("renderDrawAll", renderDrawAll, { 100, 1000, 10000 });
+    }
+    else {
+        Textures::setHeadless(true);
+    }
+
+    Jobs::start();
+
+    std::printf("%-36s %17s %12s\n", "Benchmark", "Time", "Iterations");
+    for(const auto& benchmark : Bench::registry()) {
+        Bench::run(benchmark);
+    }
+
+    clearWorld();
+    return 0;
+}
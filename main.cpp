@@ -1,7 +1,31 @@
 #include "src/game.hpp"
 
-int main()
+#include <charconv>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include <system_error>
+
+int main(int argc, char* argv[])
 {
+    // mario --headless <ticks>
+    if(argc == 3 && std::string_view(argv[1]) == "--headless")
+    {
+        const std::string_view text(argv[2]);
+
+        // from_chars doesn't take a sign, so a negative amount is rejected too
+        unsigned long ticks = 0;
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), ticks);
+        if(error != std::errc() || end != text.data() + text.size() || ticks == 0)
+        {
+            std::cerr << "usage: " << argv[0] << " --headless <ticks>, ticks is a positive number\n";
+            return EXIT_FAILURE;
+        }
+
+        Game game(HEADLESS::TRUE);
+        return game.runHeadless(ticks);
+    }
+
     Game game;
     return game.run();
 }
\ No newline at end of file
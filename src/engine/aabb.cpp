@@ -0,0 +1,99 @@
+#include "aabb.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace AABB
+{
+    COLLISION test(const sf::FloatRect& a, const sf::FloatRect& b) noexcept
+    {
+        const float aRight  = a.left + (a.width / 2);
+        const float aBottom = a.top  + (a.height / 2);
+        const float bRight  = b.left + (b.width / 2);
+        const float bBottom = b.top  + (b.height / 2);
+
+        if(a.intersects(b))
+        {
+            // Touching on the top
+            if(bBottom >= a.top && aRight >= b.left && bRight >= a.left) {
+                return COLLISION::TOP;
+            }
+
+            // Touching on the right
+            if(aRight >= b.left && aBottom >= b.top && bBottom >= a.top) {
+                return COLLISION::RIGHT;
+            }
+
+            // Touching on the left
+            if(bRight >= a.left && aBottom >= b.top && bBottom >= a.top) {
+                return COLLISION::LEFT;
+            }
+
+            // Touching on the bottom
+            if(aBottom >= b.top && aRight >= b.left && bRight >= a.left) {
+                return COLLISION::BOTTOM;
+            }
+        }
+
+        return COLLISION::NONE;
+    }
+
+#if defined(__SSE2__)
+    void test4(const sf::FloatRect& a, const Lanes& b, COLLISION result[LANES]) noexcept
+    {
+        // the same math as test, the `right` and `bottom` there are the centers
+        const __m128 aLeft    = _mm_set1_ps(a.left);
+        const __m128 aTop     = _mm_set1_ps(a.top);
+        const __m128 aMaxX    = _mm_set1_ps(a.left + a.width);
+        const __m128 aMaxY    = _mm_set1_ps(a.top + a.height);
+        const __m128 aCenterX = _mm_set1_ps(a.left + (a.width / 2));
+        const __m128 aCenterY = _mm_set1_ps(a.top + (a.height / 2));
+
+        const __m128 half     = _mm_set1_ps(0.5f);
+        const __m128 bLeft    = _mm_load_ps(b.left);
+        const __m128 bTop     = _mm_load_ps(b.top);
+        const __m128 bWidth   = _mm_load_ps(b.width);
+        const __m128 bHeight  = _mm_load_ps(b.height);
+        const __m128 bMaxX    = _mm_add_ps(bLeft, bWidth);
+        const __m128 bMaxY    = _mm_add_ps(bTop, bHeight);
+        const __m128 bCenterX = _mm_add_ps(bLeft, _mm_mul_ps(bWidth, half));
+        const __m128 bCenterY = _mm_add_ps(bTop, _mm_mul_ps(bHeight, half));
+
+        // sf::Rect::intersects
+        const __m128 intersects = _mm_and_ps(
+            _mm_cmplt_ps(_mm_max_ps(aLeft, bLeft), _mm_min_ps(aMaxX, bMaxX)),
+            _mm_cmplt_ps(_mm_max_ps(aTop, bTop),   _mm_min_ps(aMaxY, bMaxY)));
+
+        const __m128 bCenterYBelowTop = _mm_cmpge_ps(bCenterY, aTop);
+        const __m128 aCenterXAfterB   = _mm_cmpge_ps(aCenterX, bLeft);
+        const __m128 bCenterXAfterA   = _mm_cmpge_ps(bCenterX, aLeft);
+        const __m128 aCenterYBelowB   = _mm_cmpge_ps(aCenterY, bTop);
+
+        const int hit    = _mm_movemask_ps(intersects);
+        const int top    = _mm_movemask_ps(_mm_and_ps(bCenterYBelowTop, _mm_and_ps(aCenterXAfterB, bCenterXAfterA)));
+        const int right  = _mm_movemask_ps(_mm_and_ps(aCenterXAfterB,   _mm_and_ps(aCenterYBelowB, bCenterYBelowTop)));
+        const int left   = _mm_movemask_ps(_mm_and_ps(bCenterXAfterA,   _mm_and_ps(aCenterYBelowB, bCenterYBelowTop)));
+        const int bottom = _mm_movemask_ps(_mm_and_ps(aCenterYBelowB,   _mm_and_ps(aCenterXAfterB, bCenterXAfterA)));
+
+        for(std::size_t lane = 0; lane < LANES; lane++)
+        {
+            const int bit = 1 << lane;
+
+            if(not (hit & bit))     result[lane] = COLLISION::NONE;
+            else if(top & bit)      result[lane] = COLLISION::TOP;
+            else if(right & bit)    result[lane] = COLLISION::RIGHT;
+            else if(left & bit)     result[lane] = COLLISION::LEFT;
+            else if(bottom & bit)   result[lane] = COLLISION::BOTTOM;
+            else                    result[lane] = COLLISION::NONE;
+        }
+    }
+#else
+    void test4(const sf::FloatRect& a, const Lanes& b, COLLISION result[LANES]) noexcept
+    {
+        for(std::size_t lane = 0; lane < LANES; lane++) {
+            result[lane] = test(a, sf::FloatRect(b.left[lane], b.top[lane], b.width[lane], b.height[lane]));
+        }
+    }
+#endif
+} // namespace AABB
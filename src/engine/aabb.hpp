@@ -0,0 +1,43 @@
+#ifndef AABB_HPP
+#define AABB_HPP
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <cstddef>
+
+#include "helpers/enums.hpp"
+
+// ---------------------------------------------------------- //
+// Collision tests between axis aligned bounding boxes.
+// `a` is the one that is moving, the result is from which
+// side it's touching `b` (same as Physics::Helper::checkIntersections).
+//
+// test4 does the same against four boxes at once with SSE2,
+// and falls back to test when it's not available.
+// ---------------------------------------------------------- //
+namespace AABB
+{
+    constexpr std::size_t LANES = 4;
+
+    // the boxes to test against, one per lane
+    struct Lanes
+    {
+        alignas(16) float left[LANES];
+        alignas(16) float top[LANES];
+        alignas(16) float width[LANES];
+        alignas(16) float height[LANES];
+
+        void set(std::size_t lane, const sf::FloatRect& rect) noexcept
+        {
+            left[lane]   = rect.left;
+            top[lane]    = rect.top;
+            width[lane]  = rect.width;
+            height[lane] = rect.height;
+        }
+    };
+
+    COLLISION test(const sf::FloatRect& a, const sf::FloatRect& b) noexcept;
+    void test4(const sf::FloatRect& a, const Lanes& b, COLLISION result[LANES]) noexcept;
+} // namespace AABB
+
+#endif
@@ -0,0 +1,510 @@
+#ifndef ARCHETYPES_HPP
+#define ARCHETYPES_HPP
+
+// ---------------------------------------------------------- //
+// ---------------------------------------------------------- //
+// ---------------------------------------------------------- //
+// ----------------------ARCHETYPES-------------------------- //
+// ---------------------------------------------------------- //
+// ---------------------------------------------------------- //
+// ---------------------------------------------------------- //
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ---------------------------------------------------------- //
+// Archetype storage of components:
+// the entities that have the same set of the components `Ts`
+// (an archetype) are stored together in fixed size chunks, and
+// every chunk keeps one array per component (structure of arrays).
+//
+// Walking the entities of some components is walking the chunks
+// of every archetype that has all of them, array by array.
+// Adding or erasing a component moves the entity (and the rest
+// of its components) to the archetype of its new set, and the
+// last entity of the old archetype is moved into the hole.
+//
+// The chunks are never freed or moved, so a component stays
+// where it is until its own entity changes its set or another
+// entity of its archetype is removed.
+//
+// The lower 32 bits of the key are used as the index, the rest
+// of it (the generation) is compared, like in Pool.
+// ---------------------------------------------------------- //
+template<typename Key, typename... Ts>
+class ArchetypeStorage
+{
+public:
+    using KeyType = Key;
+    using Mask    = std::uint32_t;
+
+    static constexpr std::size_t CHUNK_SIZE = 128;
+    static_assert(sizeof...(Ts) <= sizeof(Mask) * 8, "Too many components!");
+
+private:
+    static constexpr std::uint32_t NONE = std::numeric_limits<std::uint32_t>::max();
+
+    struct Chunk
+    {
+        std::array<Key, CHUNK_SIZE> keys;
+
+        // nullptr for the components the archetype doesn't have
+        std::tuple<std::unique_ptr<Ts[]>...> columns;
+    };
+
+    struct Archetype
+    {
+        Mask mask;
+        std::size_t count = 0;
+        std::vector<std::unique_ptr<Chunk>> chunks;
+    };
+
+    // the row is counted over all of the chunks of the archetype,
+    // the chunk it's in is kept so a lookup doesn't go through the archetype
+    struct Location
+    {
+        std::uint32_t archetype = NONE;
+        std::uint32_t row = 0;
+        Chunk* chunk = nullptr;
+    };
+
+public:
+    template<typename T>
+    static constexpr bool stores = (std::is_same_v<T, Ts> || ...);
+
+    template<typename... Us>
+    static constexpr Mask maskOf() noexcept {
+        return (Mask(0) | ... | (Mask(1) << indexOf<Us>()));
+    }
+
+    bool contains(Key id) const noexcept {
+        return find(id) != nullptr;
+    }
+
+    template<typename T>
+    bool has(Key id) const noexcept
+    {
+        const Location* location = find(id);
+        return location != nullptr && column<T>(*location->chunk) != nullptr;
+    }
+
+    // nullptr when the entity doesn't have it
+    template<typename T>
+    T* tryGet(Key id) noexcept
+    {
+        const Location* location = find(id);
+        if(location == nullptr || column<T>(*location->chunk) == nullptr) {
+            return nullptr;
+        }
+
+        return &getAt<T>(*location);
+    }
+
+    // the entity must have it
+    template<typename T>
+    T& get(Key id) noexcept {
+        return getAt<T>(locations[indexOfKey(id)]);
+    }
+
+    template<typename T>
+    const T& get(Key id) const noexcept {
+        return getAt<T>(locations[indexOfKey(id)]);
+    }
+
+    // a default component, the entity moves to the archetype with it
+    template<typename T>
+    T& add(Key id)
+    {
+        const std::size_t index = indexOfKey(id);
+
+        // an entity of an older generation is still in here
+        if(index < locations.size() && locations[index].archetype != NONE && keyAt(locations[index]) != id) {
+            remove(keyAt(locations[index]));
+        }
+
+        const Location* location = find(id);
+        const Mask current = location != nullptr ? archetypes[location->archetype].mask : 0;
+        if(current & maskOf<T>())
+        {
+            T& component = getAt<T>(*location);
+            component = T();
+            return component;
+        }
+
+        moveTo(id, current | maskOf<T>());
+        return get<T>(id);
+    }
+
+    template<typename T>
+    void erase(Key id) noexcept
+    {
+        if(not has<T>(id)) {
+            return;
+        }
+
+        const Mask remaining = archetypes[locations[indexOfKey(id)].archetype].mask & ~maskOf<T>();
+        if(remaining == 0) {
+            remove(id);
+        }
+        else {
+            moveTo(id, remaining);
+        }
+    }
+
+    // all of the components of the entity at once
+    void remove(Key id) noexcept
+    {
+        if(not contains(id)) {
+            return;
+        }
+
+        Location& location = locations[indexOfKey(id)];
+        removeRow(location.archetype, location.row);
+        location = Location();
+    }
+
+    // how many entities have T
+    template<typename T>
+    std::size_t count() const noexcept
+    {
+        std::size_t total = 0;
+        for(const Archetype& archetype : archetypes)
+        {
+            if(archetype.mask & maskOf<T>()) {
+                total += archetype.count;
+            }
+        }
+
+        return total;
+    }
+
+    // locations + archetypes + the rows of every chunk
+    std::size_t capacity() const noexcept
+    {
+        std::size_t total = locations.capacity() + archetypes.capacity();
+        for(const Archetype& archetype : archetypes) {
+            total += archetype.chunks.capacity() + archetype.chunks.size() * CHUNK_SIZE;
+        }
+
+        return total;
+    }
+
+    // function(id, components...) for every entity that has all of `Us`,
+    // chunk after chunk. the function must not add or erase any of the
+    // components of the storage, that moves the entities around.
+    template<typename... Us, typename Function>
+    void each(Function&& function)
+    {
+        constexpr Mask wanted = maskOf<Us...>();
+
+        for(Archetype& archetype : archetypes)
+        {
+            if((archetype.mask & wanted) != wanted) {
+                continue;
+            }
+
+            for(std::size_t first = 0; first < archetype.count; first += CHUNK_SIZE)
+            {
+                Chunk& chunk = *archetype.chunks[first / CHUNK_SIZE];
+                const std::size_t rows = std::min(CHUNK_SIZE, archetype.count - first);
+
+                const std::tuple<Us*...> columns { column<Us>(chunk)... };
+                for(std::size_t row = 0; row < rows; row++) {
+                    function(chunk.keys[row], std::get<Us*>(columns)[row]...);
+                }
+            }
+        }
+    }
+
+    // ------- Access by the position among the entities of T ------- //
+    // the archetypes are walked one after another, in the order they were made
+    template<typename T>
+    Key keyAt(std::size_t index) const noexcept {
+        return keyAt(locationOf<T>(index));
+    }
+
+    template<typename T>
+    T& getAt(std::size_t index) noexcept {
+        return getAt<T>(locationOf<T>(index));
+    }
+
+    // ----------- Iterating every component of T ------------ //
+    template<typename T, bool CONST>
+    class Iterator
+    {
+    public:
+        using Storage           = std::conditional_t<CONST, const ArchetypeStorage, ArchetypeStorage>;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<CONST, const T*, T*>;
+        using reference         = std::conditional_t<CONST, const T&, T&>;
+
+        Iterator(Storage* storage, std::uint32_t archetype) noexcept
+            : m_storage(storage), m_archetype(archetype)
+        {
+            skipEmpty();
+        }
+
+        reference operator*() const noexcept { 
+            return m_storage->template getAt<T>(m_storage->locate(m_archetype, m_row)); 
+        }
+
+        pointer operator->() const noexcept { return &**this; }
+
+        Iterator& operator++() noexcept
+        {
+            m_row++;
+            skipEmpty();
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const noexcept {
+            return m_archetype == other.m_archetype && m_row == other.m_row;
+        }
+
+        bool operator!=(const Iterator& other) const noexcept {
+            return not (*this == other);
+        }
+
+    private:
+        // to the next archetype that has T, if this one is done
+        void skipEmpty() noexcept
+        {
+            const auto& archetypes = m_storage->archetypes;
+            while(m_archetype < archetypes.size())
+            {
+                const Archetype& archetype = archetypes[m_archetype];
+                if((archetype.mask & maskOf<T>()) && m_row < archetype.count) {
+                    return;
+                }
+
+                m_archetype++;
+                m_row = 0;
+            }
+        }
+
+        Storage* m_storage;
+        std::uint32_t m_archetype;
+        std::uint32_t m_row = 0;
+    };
+
+    template<typename T> Iterator<T, false> begin() noexcept      { return Iterator<T, false>(this, 0); }
+    template<typename T> Iterator<T, false> end() noexcept        { return Iterator<T, false>(this, archetypes.size()); }
+    template<typename T> Iterator<T, true> begin() const noexcept { return Iterator<T, true>(this, 0); }
+    template<typename T> Iterator<T, true> end() const noexcept   { return Iterator<T, true>(this, archetypes.size()); }
+
+private:
+    template<typename T, std::size_t I = 0>
+    static constexpr std::size_t indexOf() noexcept
+    {
+        static_assert(I < sizeof...(Ts), "T is not stored in the archetypes!");
+
+        if constexpr(std::is_same_v<T, std::tuple_element_t<I, std::tuple<Ts...>>>) {
+            return I;
+        }
+        else {
+            return indexOf<T, I + 1>();
+        }
+    }
+
+    static constexpr std::size_t indexOfKey(Key id) noexcept {
+        return static_cast<std::uint32_t>(id);
+    }
+
+    template<typename T>
+    static T* column(const Chunk& chunk) noexcept {
+        return std::get<indexOf<T>()>(chunk.columns).get();
+    }
+
+    // nullptr when the id is not in here (or an older generation of it is)
+    const Location* find(Key id) const noexcept
+    {
+        const std::size_t index = indexOfKey(id);
+        if(index >= locations.size() || locations[index].archetype == NONE) {
+            return nullptr;
+        }
+
+        const Location& location = locations[index];
+        return keyAt(location) == id ? &location : nullptr;
+    }
+
+    Location locate(std::uint32_t archetype, std::uint32_t row) const noexcept {
+        return Location { archetype, row, archetypes[archetype].chunks[row / CHUNK_SIZE].get() };
+    }
+
+    static Key keyAt(const Location& location) noexcept {
+        return location.chunk->keys[location.row % CHUNK_SIZE];
+    }
+
+    template<typename T>
+    static T& getAt(const Location& location) noexcept {
+        return column<T>(*location.chunk)[location.row % CHUNK_SIZE];
+    }
+
+    template<typename T>
+    Location locationOf(std::size_t index) const noexcept
+    {
+        for(std::uint32_t archetype = 0; archetype < archetypes.size(); archetype++)
+        {
+            if(not (archetypes[archetype].mask & maskOf<T>())) {
+                continue;
+            }
+
+            if(index < archetypes[archetype].count) {
+                return locate(archetype, index);
+            }
+
+            index -= archetypes[archetype].count;
+        }
+
+        return Location();
+    }
+
+    std::uint32_t findArchetype(Mask mask)
+    {
+        for(std::uint32_t archetype = 0; archetype < archetypes.size(); archetype++)
+        {
+            if(archetypes[archetype].mask == mask) {
+                return archetype;
+            }
+        }
+
+        archetypes.push_back(Archetype { mask });
+        return archetypes.size() - 1;
+    }
+
+    // a new row at the end of the archetype, a chunk is made when they are all full
+    Location pushRow(std::uint32_t index, Key id)
+    {
+        Archetype& archetype = archetypes[index];
+        if(archetype.count == archetype.chunks.size() * CHUNK_SIZE)
+        {
+            auto chunk = std::make_unique<Chunk>();
+            ((std::get<indexOf<Ts>()>(chunk->columns) = (archetype.mask & maskOf<Ts>()) ?
+                std::make_unique<Ts[]>(CHUNK_SIZE) : nullptr), ...);
+
+            archetype.chunks.push_back(std::move(chunk));
+        }
+
+        const Location location = locate(index, archetype.count++);
+        location.chunk->keys[location.row % CHUNK_SIZE] = id;
+
+        return location;
+    }
+
+    // moves the last row of the archetype into the hole
+    void removeRow(std::uint32_t index, std::uint32_t row) noexcept
+    {
+        Archetype& archetype = archetypes[index];
+        const std::uint32_t last = archetype.count - 1;
+
+        if(row != last)
+        {
+            const Location to   = locate(index, row);
+            const Location from = locate(index, last);
+
+            ((archetype.mask & maskOf<Ts>() ? (void)(getAt<Ts>(to) = std::move(getAt<Ts>(from))) : (void)0), ...);
+
+            const Key moved = keyAt(from);
+            to.chunk->keys[row % CHUNK_SIZE] = moved;
+            locations[indexOfKey(moved)] = to;
+        }
+
+        archetype.count--;
+    }
+
+    // the components in both of the sets are moved, the new ones are default
+    void moveTo(Key id, Mask mask)
+    {
+        const std::size_t index = indexOfKey(id);
+        if(index >= locations.size()) {
+            locations.resize(index + 1);
+        }
+
+        const Location* found = find(id);
+        const Location from = found != nullptr ? *found : Location();
+        const Mask previous = found != nullptr ? archetypes[from.archetype].mask : 0;
+
+        const Location to = pushRow(findArchetype(mask), id);
+
+        ((mask & maskOf<Ts>() ?
+            (void)(getAt<Ts>(to) = (previous & maskOf<Ts>()) ? std::move(getAt<Ts>(from)) : Ts()) : (void)0), ...);
+
+        if(found != nullptr) {
+            removeRow(from.archetype, from.row);
+        }
+
+        locations[index] = to;
+    }
+
+    std::vector<Location> locations; // entity index -> where it is
+    std::vector<Archetype> archetypes;
+};
+
+// ---------------------------------------------------------- //
+// One component of an ArchetypeStorage, with the interface of
+// a Pool, so the systems don't care where a component lives.
+// ---------------------------------------------------------- //
+template<typename Storage, typename T>
+class ArchetypeColumn
+{
+public:
+    constexpr explicit ArchetypeColumn(Storage& storage) noexcept
+        : m_storage(storage) {}
+
+    // returns the component of the id, creates a default one if it doesn't exist
+    T& operator[](typename Storage::KeyType id)
+    {
+        if(T* component = m_storage.template tryGet<T>(id)) {
+            return *component;
+        }
+
+        return m_storage.template add<T>(id);
+    }
+
+    T& emplace(typename Storage::KeyType id)              { return m_storage.template add<T>(id); }
+    T& at(typename Storage::KeyType id) noexcept             { return m_storage.template get<T>(id); }
+    const T& at(typename Storage::KeyType id) const noexcept { return m_storage.template get<T>(id); }
+    bool contains(typename Storage::KeyType id) const noexcept { return m_storage.template has<T>(id); }
+    void erase(typename Storage::KeyType id) noexcept        { m_storage.template erase<T>(id); }
+
+    typename Storage::KeyType entityAt(std::size_t index) const noexcept { return m_storage.template keyAt<T>(index); }
+    T& componentAt(std::size_t index) noexcept                          { return m_storage.template getAt<T>(index); }
+
+    // function(id, component) chunk after chunk, see ArchetypeStorage::each
+    template<typename Function>
+    void each(Function&& function) { m_storage.template each<T>(function); }
+
+    std::size_t size() const noexcept     { return m_storage.template count<T>(); }
+    bool empty() const noexcept           { return size() == 0; }
+    std::size_t capacity() const noexcept { return m_storage.capacity(); }
+
+    auto begin() noexcept       { return m_storage.template begin<T>(); }
+    auto end() noexcept         { return m_storage.template end<T>(); }
+    auto begin() const noexcept { return m_storage.template begin<T>(); }
+    auto end() const noexcept   { return m_storage.template end<T>(); }
+
+private:
+    Storage& m_storage;
+};
+
+template<typename T>
+struct is_archetype_column : std::false_type {};
+
+template<typename Storage, typename T>
+struct is_archetype_column<ArchetypeColumn<Storage, T>> : std::true_type {};
+
+template<typename T>
+inline constexpr bool is_archetype_column_v = is_archetype_column<T>::value;
+
+#endif
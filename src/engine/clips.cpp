@@ -0,0 +1,74 @@
+#include "clips.hpp"
+
+namespace Clips
+{
+    namespace
+    {
+        // the lowest animation position is Enum::Animation::NONE (-2)
+        constexpr int POSITION_OFFSET = 2;
+
+        std::vector<sf::IntRect> frames;
+        std::vector<Clip> clips;
+
+        // set -> position + POSITION_OFFSET -> clip
+        std::vector<std::vector<ClipID>> sets;
+    } // namespace
+
+    ClipID add(const AnimationVector& clip_frames)
+    {
+        clips.push_back(Clip { std::uint32_t(frames.size()), std::uint32_t(clip_frames.size()) });
+        frames.insert(frames.end(), clip_frames.begin(), clip_frames.end());
+
+        return clips.size() - 1;
+    }
+
+    const Clip& get(ClipID clip) noexcept {
+        return clips[clip];
+    }
+
+    const sf::IntRect& getFrame(const Clip& clip, std::size_t frame) noexcept {
+        return frames[clip.first + frame];
+    }
+
+    SetID createSet()
+    {
+        sets.emplace_back();
+        return sets.size() - 1;
+    }
+
+    void setClip(SetID set, int pos, ClipID clip)
+    {
+        auto& positions = sets[set];
+        const std::size_t index = pos + POSITION_OFFSET;
+
+        if(index >= positions.size()) {
+            positions.resize(index + 1, NO_CLIP);
+        }
+
+        positions[index] = clip;
+    }
+
+    ClipID setClip(SetID set, int pos, const AnimationVector& clip_frames)
+    {
+        const ClipID clip = add(clip_frames);
+        setClip(set, pos, clip);
+
+        return clip;
+    }
+
+    ClipID setClip(SetID set, int pos, const sf::IntRect& frame) {
+        return setClip(set, pos, AnimationVector { frame });
+    }
+
+    ClipID getClip(SetID set, int pos) noexcept
+    {
+        if(set == NO_SET) {
+            return NO_CLIP;
+        }
+
+        const auto& positions = sets[set];
+        const std::size_t index = pos + POSITION_OFFSET;
+
+        return index < positions.size() ? positions[index] : NO_CLIP;
+    }
+} // namespace Clips
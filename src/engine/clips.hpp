@@ -0,0 +1,49 @@
+#ifndef CLIPS_HPP
+#define CLIPS_HPP
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+using AnimationVector = std::vector<sf::IntRect>;
+
+// ---------------------------------------------------------- //
+// Animation clip library
+// the frames of every clip are stored once, and the entities
+// refer to a set of clips by a handle. a set tells which clip is
+// played for every animation position (Enum::Animation, Enum::Block ...),
+// so all of the entities of the same kind share a single set.
+// ---------------------------------------------------------- //
+namespace Clips
+{
+    using ClipID = std::uint16_t;
+    using SetID  = std::uint16_t;
+
+    constexpr ClipID NO_CLIP = std::numeric_limits<ClipID>::max();
+    constexpr SetID  NO_SET  = std::numeric_limits<SetID>::max();
+
+    struct Clip
+    {
+        std::uint32_t first; // inside of the frames of the library
+        std::uint32_t count;
+    };
+
+    ClipID add(const AnimationVector& frames);
+    const Clip& get(ClipID clip) noexcept;
+    const sf::IntRect& getFrame(const Clip& clip, std::size_t frame) noexcept;
+
+    SetID createSet();
+
+    // a clip can be in many positions and sets
+    void setClip(SetID set, int pos, ClipID clip);
+    ClipID setClip(SetID set, int pos, const AnimationVector& frames);
+    ClipID setClip(SetID set, int pos, const sf::IntRect& frame);
+
+    // NO_CLIP if there is nothing in that position
+    ClipID getClip(SetID set, int pos) noexcept;
+} // namespace Clips
+
+#endif
@@ -8,16 +8,38 @@
 #include <optional>
 #include <functional>
 #include <variant>
-#include <any>
+#include <array>
+#include <cstdint>
 
+#include "pool.hpp"
+#include "archetypes.hpp"
+#include "textures.hpp"
+#include "clips.hpp"
 #include "helpers/enums.hpp"
 #include "helpers/values.hpp"
 
 // ----- Using's ------ //
 using EntityID = long unsigned int; // similar to size_t
 
-using AnimationVector = std::vector<sf::IntRect>;
-using AnimationMap    = std::unordered_map<int, AnimationVector>;
+// ----- Entity ID ------ //
+// the lower 32 bits are the index of the entity and the upper 32 bits
+// are its generation, which goes up every time the index is reused.
+// so an id of a removed entity never points to a new one.
+constexpr std::uint32_t getEntityIndex(EntityID id) noexcept {
+    return static_cast<std::uint32_t>(id);
+}
+
+constexpr std::uint32_t getEntityGeneration(EntityID id) noexcept {
+    return static_cast<std::uint32_t>(id >> 32);
+}
+
+constexpr EntityID makeEntityID(std::uint32_t index, std::uint32_t generation) noexcept {
+    return (static_cast<EntityID>(generation) << 32) | index;
+}
+
+// a handle of a timer in Timers, built the same way, 0 is none
+using TimerID = std::uint64_t;
+
 using BlockPair       = std::pair<Enum::Block, Enum::Type>;
 using VariantWhatType = std::variant</* Block Type */     BlockPair, 
                                      /* Mario Maturity */ Enum::Mature>;
@@ -29,40 +51,58 @@ namespace Component
     // ----------- BASE ---------- //
     struct Base
     {
-        sf::Texture texture;
+        // shared between all of the entities made from the same image
+        Textures::TextureID texture;
         sf::Sprite sprite;
 
+        // where the sprite was at the start of the current tick,
+        // the renderer interpolates between it and the current one
+        sf::Vector2f previousPosition;
+
+        // the global bounds of the sprite, only computed again after
+        // the sprite was changed (see System::Base::getBounds)
+        sf::FloatRect bounds;
+        bool boundsDirty = false;
+
         StateOpt state;
     };
 
     // ----------- TYPE ---------- //
     struct Type 
     {
-        Enum::Type type;
+        Enum::Type type = Enum::Type::NONE;
 
         // assignment of what object type is
         OptVarWhatType whatType;
     }; 
     
     // ----------- ANIMATION ---------- //
+    // played by System::Animation::playAll once per tick
     struct Animation 
     {
-        sf::Clock clock;
-        unsigned int nextFrameTimer = 500; // in ms
+        // the clips of the entity in the library, and the one that is playing
+        Clips::SetID clips = Clips::NO_SET;
+        Clips::ClipID clip = Clips::NO_CLIP;
 
         int currentAnimation = -100;
-        int currentFrame;
+
+        std::uint16_t currentFrame = 0; // the next one to show
+        std::uint16_t shownFrame   = 0; // the one that is on the sprite
+
+        std::uint16_t frameTicks   = millisecondsToTicks(500);
+        std::uint16_t elapsedTicks = 0; // since the last frame
 
         bool isFinished       = false;
         bool isStarted        = false;
         bool stopWhenFinished = false;
         bool allowPlay        = true;
-
-        AnimationMap animations;
     };
 
     // --------- UPDATE FUNCTION ------------ //
-    using UpdateFunction  = std::function<void(EntityID)>;
+    // the entities are updated by the system of their type,
+    // this is only for an entity that needs something of its own.
+    // a plain function pointer, calling it doesn't allocate or copy anything
+    using UpdateFunction  = void(*)(EntityID);
 
     // ----------- MOVEMENT ---------- //
     struct Movement 
@@ -71,8 +111,10 @@ namespace Component
         bool isRunning = false;
         bool isJumping = false;
         
-        Enum::Direction lookingDirection;
-        Enum::Direction blockedDirection;
+        // everything starts looking to the right, and isn't blocked
+        // by anything until its first physics step
+        Enum::Direction lookingDirection = Enum::Direction::RIGHT;
+        Enum::Direction blockedDirection = Enum::Direction::NONE;
     };
 
     // ----------- PHYSICS ---------- //
@@ -81,37 +123,84 @@ namespace Component
         bool isRigidbody;
         bool onGround;
         float speed = FALL_SPEED;
-        unsigned int maxJumpHeight = 400;
+        unsigned int maxJumpHeight = 400; // in ms
+
+        TimerID jumpTimer = 0; // ends the jump
+    };
+
+    // -------- STATES ------------- //
+    // small typed states that only some of the entities have
 
-        sf::Clock jumpClock;
+    // walks to one side until it hits something (Goomba, Spiny, Mushroom)
+    struct WalkerState
+    {
+        bool moveLeft = true;
+    };
+
+    // question mark block, spawns what is inside of it once
+    struct BlockState
+    {
+        bool spawned = false;
+    };
+
+    // jumps once out of the block it came from (Mushroom, Flower)
+    struct PopOutState
+    {
+        bool jumpOut = true;
+    };
+
+    struct FireState
+    {
+        bool moveRight = true;
     };
 
-    // -------- GLOBALS ------------- //
-    struct GlobalVariables
+    struct PlayerState
     {
-        std::optional<sf::Clock> clock;
-        std::vector<std::any> values;
+        bool canShoot = true; // turned back on by a timer after shooting
+
+        // the maturity its texture was set for, it's only swapped when that changes
+        std::optional<Enum::Mature> texturedAs;
     };
 } // namespace Component
 
 // ----- Using's ----- //
-using ComponentBaseMap      = std::unordered_map<EntityID, Component::Base>;
-using ComponentTypeMap      = std::unordered_map<EntityID, Component::Type>;
-using ComponentAnimationMap = std::unordered_map<EntityID, Component::Animation>;
-using ComponentUpdateMap    = std::unordered_map<EntityID, Component::UpdateFunction>;
-using ComponentMovementMap  = std::unordered_map<EntityID, Component::Movement>;
-using ComponentPhysicsMap   = std::unordered_map<EntityID, Component::Physics>;
-using ComponentGlobalVarMap = std::unordered_map<EntityID, Component::GlobalVariables>;
+// the components every moving entity has live together in archetype chunks,
+// the rest of them in their own pools
+using ComponentArchetypes   = ArchetypeStorage<EntityID, Component::Base, Component::Physics, Component::Movement>;
+
+using ComponentBaseMap      = ArchetypeColumn<ComponentArchetypes, Component::Base>;
+using ComponentTypeMap      = Pool<EntityID, Component::Type>;
+using ComponentAnimationMap = Pool<EntityID, Component::Animation>;
+using ComponentUpdateMap    = Pool<EntityID, Component::UpdateFunction>;
+using ComponentMovementMap  = ArchetypeColumn<ComponentArchetypes, Component::Movement>;
+using ComponentPhysicsMap   = ArchetypeColumn<ComponentArchetypes, Component::Physics>;
+using ComponentWalkerMap    = Pool<EntityID, Component::WalkerState>;
+using ComponentBlockMap     = Pool<EntityID, Component::BlockState>;
+using ComponentPopOutMap    = Pool<EntityID, Component::PopOutState>;
+using ComponentFireMap      = Pool<EntityID, Component::FireState>;
+using ComponentPlayerMap    = Pool<EntityID, Component::PlayerState>;
+
+// the entities of one type, the value is the id itself
+using ComponentMemberSet    = Pool<EntityID, EntityID>;
 
 namespace Component
 {
-    inline ComponentBaseMap      bases;
+    inline ComponentArchetypes   archetypes;
+
+    inline ComponentBaseMap      bases { archetypes };
     inline ComponentTypeMap      types;
     inline ComponentAnimationMap animations;
     inline ComponentUpdateMap    updates;
-    inline ComponentMovementMap  movements;
-    inline ComponentPhysicsMap   physics;
-    inline ComponentGlobalVarMap globalVariables;
+    inline ComponentMovementMap  movements { archetypes };
+    inline ComponentPhysicsMap   physics { archetypes };
+    inline ComponentWalkerMap    walkerStates;
+    inline ComponentBlockMap     blockStates;
+    inline ComponentPopOutMap    popOutStates;
+    inline ComponentFireMap      fireStates;
+    inline ComponentPlayerMap    playerStates;
+
+    // indexed by Enum::Type
+    inline std::array<ComponentMemberSet, Enum::TYPE_COUNT> typeMembers;
 } // namespace Component
 
 #endif
\ No newline at end of file
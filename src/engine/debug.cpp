@@ -0,0 +1,99 @@
+#include "debug.hpp"
+#include "components.hpp"
+#include "manager.hpp"
+#include "spatial.hpp"
+#include "system.hpp"
+#include "timers.hpp"
+#include "jobs.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#ifdef ENABLE_DEBUG_MODE
+namespace 
+{
+    std::atomic<std::size_t> allocationCounter = 0;
+} // namespace
+
+// ---------- Counting every allocation of the program ---------- //
+void* operator new(std::size_t size)
+{
+    allocationCounter.fetch_add(1, std::memory_order_relaxed);
+
+    if(void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+#endif
+
+namespace Debug
+{
+    std::size_t getAllocations() noexcept
+    {
+        #ifdef ENABLE_DEBUG_MODE
+        return allocationCounter.load(std::memory_order_relaxed);
+        #else
+        return 0;
+        #endif
+    }
+
+    FrameAllocationCheck::FrameAllocationCheck(const System::Render* render) noexcept
+        : render(render), allocations(getAllocations()), signature(worldSignature()) {}
+
+    FrameAllocationCheck::~FrameAllocationCheck() noexcept
+    {
+        #ifdef ENABLE_DEBUG_MODE
+        const bool steady = frames >= WARM_UP_FRAMES && signature == worldSignature();
+        if(steady && getAllocations() != allocations) 
+        {
+            std::cerr << "Frame " << frames << ": " << getAllocations() - allocations 
+                      << " heap allocations in a steady-state frame!" << std::endl;
+        }
+        #endif
+
+        frames++;
+    }
+
+    // changes whenever the world is allowed to allocate
+    FrameAllocationCheck::Signature FrameAllocationCheck::worldSignature() const noexcept
+    {
+        return Signature {
+            Component::bases.size(),
+            System::Game::getPendingRemovals(),
+            Manager::getCapacity(),
+            Spatial::grid.getCapacity(),
+            Spatial::tiles.getCapacity(),
+            Timers::getCapacity(),
+            Jobs::getCapacity(),
+            System::Game::getCapacity(),
+            System::Activation::getCapacity(),
+            System::Base::getCapacity(),
+            System::Physics::getCapacity(),
+            render ? render->getCapacity() : 0
+        };
+    }
+} // namespace Debug
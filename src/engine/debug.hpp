@@ -0,0 +1,53 @@
+#ifndef DEBUG_HPP
+#define DEBUG_HPP
+
+// ---------------------------------------------------------- //
+// ---------------------------------------------------------- //
+// ---------------------------------------------------------- //
+// -------------------------DEBUG---------------------------- //
+// ---------------------------------------------------------- //
+// ---------------------------------------------------------- //
+// ---------------------------------------------------------- //
+
+#include <array>
+#include <cstddef>
+
+namespace System 
+{
+    class Render;
+} // namespace System
+
+namespace Debug
+{
+    // amount of heap allocations since the program started
+    // this is only counted when ENABLE_DEBUG_MODE is defined
+    std::size_t getAllocations() noexcept;
+
+    // ---------------------------------------------------------- //
+    // Reports a frame that allocated from the heap.
+    // Only steady-state frames are checked: after the warm-up frames,
+    // and when no entity was created or removed and none of the
+    // buffers of the engine grew during the frame.
+    // ---------------------------------------------------------- //
+    class FrameAllocationCheck
+    {
+    public:
+        // the batches of the render are checked too if there is one
+        explicit FrameAllocationCheck(const System::Render* render = nullptr) noexcept;
+        ~FrameAllocationCheck() noexcept;
+
+    private:
+        static constexpr unsigned int WARM_UP_FRAMES = 60;
+        static inline unsigned int frames = 0;
+
+        // the amount of entities and the capacity of every buffer that can grow
+        using Signature = std::array<std::size_t, 12>;
+        Signature worldSignature() const noexcept;
+
+        const System::Render* render;
+        std::size_t allocations;
+        Signature signature;
+    };
+} // namespace Debug
+
+#endif
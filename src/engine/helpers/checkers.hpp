@@ -31,7 +31,11 @@ struct is_component {
         std::is_same_v<T, Component::UpdateFunction> or
         std::is_same_v<T, Component::Movement>       or
         std::is_same_v<T, Component::Physics>        or
-        std::is_same_v<T, Component::GlobalVariables>
+        std::is_same_v<T, Component::WalkerState>    or
+        std::is_same_v<T, Component::BlockState>     or
+        std::is_same_v<T, Component::PopOutState>    or
+        std::is_same_v<T, Component::FireState>      or
+        std::is_same_v<T, Component::PlayerState>
     };
 };
 
@@ -9,6 +9,8 @@
 // ---------------------------------------------------------- //
 // ---------------------------------------------------------- //
 
+#include <cstddef>
+
 namespace Enum 
 {
     // ----------- TYPE ----------- //
@@ -27,6 +29,8 @@ namespace Enum
         PIPE
     };
 
+    constexpr std::size_t TYPE_COUNT = std::size_t(Type::PIPE) + 1;
+
     // --------- STATE ------------ //
     enum class State {
         DEAD,
@@ -92,6 +96,7 @@ using FORCE         = Enum::BOOLEAN;
 using WAIT_FOR_ANIM = Enum::BOOLEAN;
 using IS_PLAYER     = Enum::BOOLEAN;
 using GET_FROM      = Enum::BOOLEAN;
+using HEADLESS      = Enum::BOOLEAN;
 using COLLISION     = Enum::Direction;
     
 #endif
\ No newline at end of file
@@ -9,6 +9,19 @@
 // ---------------------------------------------------------- //
 // ---------------------------------------------------------- //
 
+#include <cstddef>
+
+// Simulation
+// the movement values below are pixels per tick, they were tuned at 45 frames per second
+constexpr unsigned int TICKS_PER_SECOND    = 45;
+constexpr unsigned int MAX_TICKS_PER_FRAME = 5; // catching up after a hitch is capped
+constexpr std::size_t  PHYSICS_JOB_CHUNK   = 64; // bodies, less than that runs on the main thread
+
+// rounded up, so it runs out on the same tick as a clock of the same length would
+constexpr unsigned int millisecondsToTicks(unsigned int ms) noexcept {
+    return (ms * TICKS_PER_SECOND + 999) / 1000;
+}
+
 // Player
 constexpr float        PLAYER_SPEED                    = 2;
 constexpr unsigned int PLAYER_JUMP                     = 400;
@@ -20,14 +33,20 @@ constexpr unsigned int PLAYER_PICKED_FLOWER_ON_FLOOR   = 50;
 
 // Fire
 constexpr float        FIRE_SPEED      = SHIFTING_PLAYER_SPEED + 1;
-constexpr unsigned int FIRE_HEIGHT     = 120;  // ms - this is being counted with a clock
+constexpr unsigned int FIRE_HEIGHT     = 120;  // ms - this is being counted in ticks
 constexpr unsigned int FIRE_KILL_TIMER = 3000; // ms
+constexpr std::size_t  FIRE_POOL_SIZE  = FIRE_KILL_TIMER / PLAYER_FIRE + 1; // more than can fly at once
 
 // Some Defaults
 constexpr float        ENEMY_SPEED    = 0.6;
 constexpr float        FALL_SPEED     = 4;
 constexpr unsigned int POINTS_VALUE   = 10;
 
+// Collision
+constexpr float TILE_SIZE         = 16;
+constexpr float SPATIAL_CELL_SIZE = TILE_SIZE * 2;
+constexpr float ACTIVATION_MARGIN = TILE_SIZE * 4; // around the camera, still being simulated
+
 constexpr float POP_OUT_MUSHROOM_SPEED = FALL_SPEED;
 constexpr float POP_OUT_FLOWER_SPEED   = FALL_SPEED;
 
@@ -0,0 +1,25 @@
+#include "input.hpp"
+
+namespace Input
+{
+    namespace 
+    {
+        Source currentSource = Input::keyboard;
+    } // namespace
+
+    void setSource(Source source) noexcept {
+        currentSource = source;
+    }
+
+    bool isKeyPressed(sf::Keyboard::Key key) noexcept {
+        return currentSource(key);
+    }
+
+    bool keyboard(sf::Keyboard::Key key) noexcept {
+        return sf::Keyboard::isKeyPressed(key);
+    }
+
+    bool nothing(sf::Keyboard::Key) noexcept {
+        return false;
+    }
+} // namespace Input
@@ -0,0 +1,23 @@
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include <SFML/Window/Keyboard.hpp>
+
+// ---------------------------------------------------------- //
+// Keyboard input goes through here instead of sf::Keyboard,
+// so a different source (a script, a replay, nothing at all
+// when running headless) can be plugged in.
+// ---------------------------------------------------------- //
+namespace Input
+{
+    using Source = bool(*)(sf::Keyboard::Key key);
+
+    void setSource(Source source) noexcept;
+    bool isKeyPressed(sf::Keyboard::Key key) noexcept;
+
+    // ----------- Sources ------------ //
+    bool keyboard(sf::Keyboard::Key key) noexcept;
+    bool nothing(sf::Keyboard::Key key) noexcept;
+} // namespace Input
+
+#endif
@@ -0,0 +1,232 @@
+#include "jobs.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Jobs
+{
+    namespace
+    {
+        struct Range
+        {
+            std::size_t begin;
+            std::size_t end;
+        };
+
+        // the owner takes from the back, the others steal from the front
+        struct Queue
+        {
+            std::mutex mutex;
+            std::vector<Range> ranges;
+            std::size_t front = 0;
+
+            void push(const Range& range)
+            {
+                std::lock_guard lock(mutex);
+                ranges.push_back(range);
+            }
+
+            bool pop(Range& range)
+            {
+                std::lock_guard lock(mutex);
+                if(front == ranges.size()) {
+                    return false;
+                }
+
+                range = ranges.back();
+                ranges.pop_back();
+                reset();
+
+                return true;
+            }
+
+            bool steal(Range& range)
+            {
+                std::lock_guard lock(mutex);
+                if(front == ranges.size()) {
+                    return false;
+                }
+
+                range = ranges[front++];
+                reset();
+
+                return true;
+            }
+
+            // keeps the memory of the vector
+            void reset() noexcept
+            {
+                if(front == ranges.size())
+                {
+                    ranges.clear();
+                    front = 0;
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        std::vector<std::unique_ptr<Queue>> queues = [] {
+            std::vector<std::unique_ptr<Queue>> main;
+            main.push_back(std::make_unique<Queue>());
+            return main;
+        }();
+
+        std::mutex wakeMutex;
+        std::condition_variable wake;
+        std::size_t batch = 0; // goes up with every parallelFor
+        bool quit = false;
+
+        RangeFunction currentFunction = nullptr;
+        void* currentContext = nullptr;
+        std::atomic<std::size_t> remaining { 0 };
+
+        bool take(unsigned int thread, Range& range)
+        {
+            if(queues[thread]->pop(range)) {
+                return true;
+            }
+
+            for(std::size_t i = 1; i < queues.size(); i++)
+            {
+                if(queues[(thread + i) % queues.size()]->steal(range)) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void runAvailable(unsigned int thread)
+        {
+            Range range;
+            while(remaining.load(std::memory_order_acquire) > 0 && take(thread, range))
+            {
+                currentFunction(currentContext, range.begin, range.end, thread);
+                remaining.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        void work(unsigned int thread)
+        {
+            std::size_t seen = 0;
+            while(true)
+            {
+                {
+                    std::unique_lock lock(wakeMutex);
+                    wake.wait(lock, [&seen] { return quit || batch != seen; });
+
+                    if(quit) {
+                        return;
+                    }
+
+                    seen = batch;
+                }
+
+                runAvailable(thread);
+            }
+        }
+
+        // joins the workers before the rest of the statics are gone
+        struct Shutdown
+        {
+            ~Shutdown() { stop(); }
+        } shutdown;
+    } // namespace
+
+    void start(unsigned int workerCount)
+    {
+        if(not workers.empty()) {
+            return;
+        }
+
+        if(workerCount == 0) {
+            workerCount = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+        }
+
+        quit = false;
+        for(unsigned int i = 1; i <= workerCount; i++) {
+            queues.push_back(std::make_unique<Queue>());
+        }
+
+        for(unsigned int i = 1; i <= workerCount; i++) {
+            workers.emplace_back(work, i);
+        }
+    }
+
+    void stop() noexcept
+    {
+        {
+            std::lock_guard lock(wakeMutex);
+            quit = true;
+        }
+        wake.notify_all();
+
+        for(auto& worker : workers) {
+            worker.join();
+        }
+
+        workers.clear();
+        queues.resize(1);
+    }
+
+    unsigned int getThreadCount() noexcept {
+        return queues.size();
+    }
+
+    std::size_t getCapacity() noexcept
+    {
+        std::size_t capacity = queues.capacity();
+        for(const auto& queue : queues)
+        {
+            std::lock_guard lock(queue->mutex);
+            capacity += queue->ranges.capacity();
+        }
+
+        return capacity;
+    }
+
+    void parallelFor(std::size_t count, std::size_t chunk, RangeFunction function, void* context) noexcept
+    {
+        chunk = std::max<std::size_t>(chunk, 1);
+
+        // not worth waking anyone up
+        if(workers.empty() || count <= chunk)
+        {
+            if(count > 0) {
+                function(context, 0, count, 0);
+            }
+
+            return;
+        }
+
+        const std::size_t chunks = (count + chunk - 1) / chunk;
+
+        currentFunction = function;
+        currentContext  = context;
+        remaining.store(chunks, std::memory_order_release);
+
+        for(std::size_t i = 0; i < chunks; i++)
+        {
+            const Range range { i * chunk, std::min(count, (i + 1) * chunk) };
+            queues[i % queues.size()]->push(range);
+        }
+
+        {
+            std::lock_guard lock(wakeMutex);
+            batch++;
+        }
+        wake.notify_all();
+
+        runAvailable(0);
+
+        // the last chunks are still running on the workers
+        while(remaining.load(std::memory_order_acquire) > 0) {
+            std::this_thread::yield();
+        }
+    }
+} // namespace Jobs
@@ -0,0 +1,43 @@
+#ifndef JOBS_HPP
+#define JOBS_HPP
+
+#include <cstddef>
+
+// ---------------------------------------------------------- //
+// A small work stealing job system.
+// parallelFor splits a range into chunks and spreads them over
+// the queues of the threads, every thread works through its own
+// queue and steals from the others when it runs out.
+//
+// The calling thread works too, and parallelFor returns only
+// when every chunk is done. It must only be called from the
+// main thread, and not from inside of another parallelFor.
+// ---------------------------------------------------------- //
+namespace Jobs
+{
+    // `thread` is in [0, getThreadCount()), the calling thread is 0
+    using RangeFunction = void(*)(void* context, std::size_t begin, std::size_t end, unsigned int thread);
+
+    // 0 workers - one for every hardware thread but the calling one
+    void start(unsigned int workers = 0);
+    void stop() noexcept;
+
+    // the workers and the calling thread
+    unsigned int getThreadCount() noexcept;
+
+    // the queues + the ranges every queue has room for
+    std::size_t getCapacity() noexcept;
+
+    void parallelFor(std::size_t count, std::size_t chunk, RangeFunction function, void* context) noexcept;
+
+    // function(begin, end, thread)
+    template<typename Function>
+    void parallelFor(std::size_t count, std::size_t chunk, Function& function) noexcept
+    {
+        parallelFor(count, chunk, [](void* context, std::size_t begin, std::size_t end, unsigned int thread) {
+            (*static_cast<Function*>(context))(begin, end, thread);
+        }, &function);
+    }
+} // namespace Jobs
+
+#endif
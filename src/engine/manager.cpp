@@ -1,24 +1,79 @@
 #include "manager.hpp"
+#include "spatial.hpp"
+#include "textures.hpp"
 #include "helpers/functions.hpp"
 #include "helpers/values.hpp"
 
 #include <exception>
 #include <iostream>
+#include <vector>
+#include <cstdint>
 
 namespace Manager
 {
+    namespace 
+    {
+        // the current generation of every index
+        std::vector<std::uint32_t> generations;
+
+        // indices of removed entities, waiting to be reused
+        std::vector<std::uint32_t> freeIndices;
+
+        // stops the system of its type from updating it
+        void removeFromTypeMembers(EntityID id) noexcept
+        {
+            const Enum::Type type = Component::types.at(id).type;
+            if(type != Enum::Type::NONE) {
+                Component::typeMembers[std::size_t(type)].erase(id);
+            }
+        }
+
+        // everything but the archetype components and the type
+        void eraseComponents(EntityID id) noexcept
+        {
+            Component::animations.erase(id);
+            Component::updates.erase(id);
+            Component::walkerStates.erase(id);
+            Component::blockStates.erase(id);
+            Component::popOutStates.erase(id);
+            Component::fireStates.erase(id);
+            Component::playerStates.erase(id);
+        }
+    } // namespace
+
     EntityID create(const std::string& png)
     {
-        EntityID currentID = Component::bases.size();
+        std::uint32_t index;
+        if(not freeIndices.empty()) 
+        {
+            index = freeIndices.back();
+            freeIndices.pop_back();
+        }
+        else 
+        {
+            index = generations.size();
+            generations.push_back(0);
+        }
+
+        EntityID currentID = makeEntityID(index, generations[index]);
 
         addComponent<Component::Base>(currentID);
         addComponent<Component::Type>(currentID);
 
-        if(not Component::bases[currentID].texture.loadFromFile(png)) {
-            throw std::runtime_error(std::string("Failed to load " + png));
-        }
+        auto& base = Component::bases[currentID];
+        base.texture = Textures::load(png);
 
-        Component::bases[currentID].sprite.setTexture(Component::bases[currentID].texture);
+        if(Textures::isHeadless()) 
+        {
+            // nothing to draw with, but the collisions still need the size
+            const sf::Vector2u size = Textures::getSize(base.texture);
+            base.sprite.setTextureRect(sf::IntRect(0, 0, size.x, size.y));
+        }
+        else {
+            base.sprite.setTexture(Textures::get(base.texture));
+        }
+        base.bounds = base.sprite.getGlobalBounds();
+        Spatial::grid.update(currentID, base.bounds);
 
         #ifdef ENABLE_DEBUG_MODE
         std::cout << "ID: " << currentID << " Created! - " << png << std::endl;
@@ -29,30 +84,110 @@ namespace Manager
 
     bool canAccess(EntityID id) noexcept
     {
-        // Bases is a must for all of the components
-        // if it doesn't have any value, the other 
-        // components will not respond well.
-        if(Component::bases.find(id) != Component::bases.end()) {
-            return true;
-        }
-
-        return false;
+        // the generation goes up when an entity is removed,
+        // so only the living id has the same generation
+        const std::uint32_t index = getEntityIndex(id);
+        return index < generations.size() && generations[index] == getEntityGeneration(id);
     }
 
     void remove(EntityID id) noexcept 
     {
         if(Manager::canAccess(id))
         {
-            Component::bases.erase(id);
+            removeFromTypeMembers(id);
+            Component::archetypes.remove(id);
             Component::types.erase(id);
-            Component::animations.erase(id);
-            Component::movements.erase(id);
-            Component::physics.erase(id);
-            Component::updates.erase(id);
+            eraseComponents(id);
+            Spatial::remove(id);
+
+            const std::uint32_t index = getEntityIndex(id);
+            generations[index]++;
+            freeIndices.push_back(index);
 
             #ifdef ENABLE_DEBUG_MODE
             std::cout << "ID: " << id << " Removed! - " << std::endl;
             #endif
         } 
     }
+
+    EntityID recycle(EntityID id) noexcept
+    {
+        if(not Manager::canAccess(id)) {
+            return id;
+        }
+
+        removeFromTypeMembers(id);
+        eraseComponents(id);
+        Spatial::remove(id);
+
+        Component::Base base = std::move(Component::bases.at(id));
+        Component::archetypes.remove(id);
+        Component::types.erase(id);
+
+        const std::uint32_t index = getEntityIndex(id);
+        generations[index]++;
+
+        // it's out of the grid until it's placed again
+        const EntityID recycledID = makeEntityID(index, generations[index]);
+        base.boundsDirty = false;
+
+        Component::bases.emplace(recycledID) = std::move(base);
+        Component::types.emplace(recycledID);
+
+        return recycledID;
+    }
+
+    std::size_t getCapacity() noexcept
+    {
+        std::size_t capacity = generations.capacity() + freeIndices.capacity() +
+                               Component::archetypes.capacity()   + Component::types.capacity() +
+                               Component::animations.capacity()   + Component::updates.capacity() +
+                               Component::walkerStates.capacity() + Component::blockStates.capacity() +
+                               Component::popOutStates.capacity() + Component::fireStates.capacity() +
+                               Component::playerStates.capacity();
+
+        for(const auto& members : Component::typeMembers) {
+            capacity += members.capacity();
+        }
+
+        return capacity;
+    }
+
+    void removeBatch(const std::vector<EntityID>& ids) noexcept
+    {
+        // erasing an id that is not in a pool does nothing,
+        // so the removed / old ones are safe in here
+        for(const EntityID id : ids) 
+        {
+            if(Component::types.contains(id)) {
+                removeFromTypeMembers(id);
+            }
+        }
+
+        for(const EntityID id : ids) Component::archetypes.remove(id);
+        for(const EntityID id : ids) Component::types.erase(id);
+        for(const EntityID id : ids) Component::animations.erase(id);
+        for(const EntityID id : ids) Component::updates.erase(id);
+        for(const EntityID id : ids) Component::walkerStates.erase(id);
+        for(const EntityID id : ids) Component::blockStates.erase(id);
+        for(const EntityID id : ids) Component::popOutStates.erase(id);
+        for(const EntityID id : ids) Component::fireStates.erase(id);
+        for(const EntityID id : ids) Component::playerStates.erase(id);
+
+        for(const EntityID id : ids)
+        {
+            if(Manager::canAccess(id))
+            {
+                Spatial::remove(id);
+
+                const std::uint32_t index = getEntityIndex(id);
+                generations[index]++;
+                freeIndices.push_back(index);
+
+                #ifdef ENABLE_DEBUG_MODE
+                std::cout << "ID: " << id << " Removed! - " << std::endl;
+                #endif
+            }
+        }
+    }
 } // namespace Manager
\ No newline at end of file
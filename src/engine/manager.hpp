@@ -2,6 +2,10 @@
 #define MANAGER_HPP
 
 #include <SFML/Graphics.hpp>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <cstddef>
 
 #include "components.hpp"
 #include "helpers/checkers.hpp"
@@ -13,6 +17,19 @@ namespace Manager
     bool canAccess(EntityID id) noexcept;
     void remove(EntityID id) noexcept;
 
+    // removes all of them, one component pool after another
+    void removeBatch(const std::vector<EntityID>& ids) noexcept;
+
+    // keeps the base of the entity (the texture) and drops the rest, the
+    // returned id is the same index with the next generation, so the old
+    // id stops being accessible like a removed one. it has no type and
+    // it's not in the world until it's placed and given a type again.
+    // an id that can't be accessed anymore is returned as it is
+    EntityID recycle(EntityID id) noexcept;
+
+    // generations + free indices + the archetypes + every other component pool + the type members
+    std::size_t getCapacity() noexcept;
+
     template<typename T>
     constexpr std::enable_if_t<is_component_v<T>> addComponent(EntityID id) noexcept
     {
@@ -31,9 +48,98 @@ namespace Manager
         else if constexpr(std::is_same_v<T, Component::Physics>) {
             Component::physics[id] = T();
         }
-        else if constexpr(std::is_same_v<T, Component::GlobalVariables>){
-            Component::globalVariables[id] = T();
+        else if constexpr(std::is_same_v<T, Component::WalkerState>) {
+            Component::walkerStates[id] = T();
+        }
+        else if constexpr(std::is_same_v<T, Component::BlockState>) {
+            Component::blockStates[id] = T();
+        }
+        else if constexpr(std::is_same_v<T, Component::PopOutState>) {
+            Component::popOutStates[id] = T();
+        }
+        else if constexpr(std::is_same_v<T, Component::FireState>) {
+            Component::fireStates[id] = T();
+        }
+        else if constexpr(std::is_same_v<T, Component::PlayerState>) {
+            Component::playerStates[id] = T();
+        }
+    }
+
+    // the pool that keeps the components of type T
+    template<typename T>
+    constexpr auto& getPool() noexcept
+    {
+        static_assert(is_component_v<T>, "T is not a component!");
+
+        if constexpr(std::is_same_v<T, Component::Base>)                 return Component::bases;
+        else if constexpr(std::is_same_v<T, Component::Type>)            return Component::types;
+        else if constexpr(std::is_same_v<T, Component::Animation>)       return Component::animations;
+        else if constexpr(std::is_same_v<T, Component::UpdateFunction>)  return Component::updates;
+        else if constexpr(std::is_same_v<T, Component::Movement>)       return Component::movements;
+        else if constexpr(std::is_same_v<T, Component::Physics>)         return Component::physics;
+        else if constexpr(std::is_same_v<T, Component::WalkerState>)     return Component::walkerStates;
+        else if constexpr(std::is_same_v<T, Component::BlockState>)      return Component::blockStates;
+        else if constexpr(std::is_same_v<T, Component::PopOutState>)     return Component::popOutStates;
+        else if constexpr(std::is_same_v<T, Component::FireState>)       return Component::fireStates;
+        else if constexpr(std::is_same_v<T, Component::PlayerState>)     return Component::playerStates;
+    }
+
+    // ---------------------------------------------------------- //
+    // All of the entities that have every one of the components:
+    //   Manager::view<Component::Physics, Component::Movement>().each(
+    //       [](EntityID id, Component::Physics& physics, Component::Movement& movement) { ... });
+    //
+    // When all of them live in Component::archetypes, it walks the
+    // chunks of every archetype that has them, array by array.
+    // Otherwise it walks the smallest of the pools in its dense order,
+    // and looks up the rest of the components of every entity in it.
+    // The components are passed by reference, so entities must not be
+    // created inside of `each`, and no component may be added or erased:
+    // that can grow a pool or move an entity to another archetype, and
+    // leave the references dangling. Creating them has to wait for
+    // after the loop, and removing must go through System::Game::removeID.
+    // ---------------------------------------------------------- //
+    template<typename... Ts>
+    class View
+    {
+    public:
+        template<typename Function>
+        void each(Function&& function)
+        {
+            if constexpr((ComponentArchetypes::stores<Ts> && ...))
+            {
+                Component::archetypes.each<Ts...>(function);
+                return;
+            }
+
+            const std::array<std::size_t, sizeof...(Ts)> sizes { getPool<Ts>().size()... };
+            const std::size_t lead  = std::min_element(sizes.begin(), sizes.end()) - sizes.begin();
+            const std::size_t count = sizes[lead];
+
+            for(std::size_t index = 0; index < count; index++)
+            {
+                const EntityID id = entityAt(lead, index);
+                if((getPool<Ts>().contains(id) && ...)) {
+                    function(id, getPool<Ts>().at(id)...);
+                }
+            }
+        }
+
+    private:
+        static EntityID entityAt(std::size_t pool, std::size_t index) noexcept
+        {
+            EntityID id = 0;
+            std::size_t current = 0;
+            ((current++ == pool ? (id = getPool<Ts>().entityAt(index), true) : false) || ...);
+
+            return id;
         }
+    };
+
+    template<typename... Ts>
+    View<Ts...> view() noexcept {
+        static_assert(sizeof...(Ts) > 0, "View of nothing!");
+        return View<Ts...>();
     }
 }   
 
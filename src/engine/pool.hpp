@@ -0,0 +1,147 @@
+#ifndef POOL_HPP
+#define POOL_HPP
+
+// ---------------------------------------------------------- //
+// ---------------------------------------------------------- //
+// ---------------------------------------------------------- //
+// -------------------------POOL----------------------------- //
+// ---------------------------------------------------------- //
+// ---------------------------------------------------------- //
+// ---------------------------------------------------------- //
+
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// ---------------------------------------------------------- //
+// Sparse set of components:
+// `dense`    - the components packed one after another
+// `entities` - which entity owns the component at the same index
+// `sparse`   - entity index -> index inside of dense
+//
+// Lookups are a single array index and iterating the pool
+// walks contiguous memory. Removing swaps the last component
+// into the hole, so the order of the dense array is not stable.
+//
+// The lower 32 bits of the key are used as the index, the rest
+// of it (the generation) is compared against `entities`, so an
+// old key of a reused index is not found.
+// ---------------------------------------------------------- //
+template<typename Key, typename T>
+class Pool
+{
+public:
+    using Iterator      = typename std::vector<T>::iterator;
+    using ConstIterator = typename std::vector<T>::const_iterator;
+
+    // returns the component of the id, creates a default one if it doesn't exist
+    // similar to std::unordered_map::operator[]
+    T& operator[](Key id)
+    {
+        if(not contains(id)) {
+            return emplace(id);
+        }
+
+        return dense[sparse[indexOf(id)]];
+    }
+
+    T& emplace(Key id)
+    {
+        const std::size_t index = indexOf(id);
+        if(index >= sparse.size()) {
+            sparse.resize(index + 1, NONE);
+        }
+
+        // a component of an older generation is still in here
+        if(sparse[index] != NONE) {
+            erase(entities[sparse[index]]);
+        }
+
+        sparse[index] = dense.size();
+        entities.push_back(id);
+        dense.emplace_back();
+
+        return dense.back();
+    }
+
+    T& at(Key id) noexcept {
+        return dense[sparse[indexOf(id)]];
+    }
+
+    const T& at(Key id) const noexcept {
+        return dense[sparse[indexOf(id)]];
+    }
+
+    bool contains(Key id) const noexcept 
+    {
+        const std::size_t index = indexOf(id);
+        return index < sparse.size() && sparse[index] != NONE && entities[sparse[index]] == id;
+    }
+
+    void erase(Key id) noexcept
+    {
+        if(not contains(id)) {
+            return;
+        }
+
+        const std::size_t index = sparse[indexOf(id)];
+        const std::size_t last  = dense.size() - 1;
+
+        if(index != last)
+        {
+            dense[index]    = std::move(dense[last]);
+            entities[index] = entities[last];
+            sparse[indexOf(entities[index])] = index;
+        }
+
+        dense.pop_back();
+        entities.pop_back();
+        sparse[indexOf(id)] = NONE;
+    }
+
+    // keeps the memory, only the slots that are in use are reset
+    void clear() noexcept
+    {
+        for(const Key id : entities) {
+            sparse[indexOf(id)] = NONE;
+        }
+
+        dense.clear();
+        entities.clear();
+    }
+
+    // ------- Access by the position in the dense array ------- //
+    Key entityAt(std::size_t index) const noexcept {
+        return entities[index];
+    }
+
+    T& componentAt(std::size_t index) noexcept {
+        return dense[index];
+    }
+
+    std::size_t size() const noexcept  { return dense.size(); }
+    bool empty() const noexcept        { return dense.empty(); }
+
+    // changes only when the pool allocated
+    std::size_t capacity() const noexcept { return dense.capacity() + sparse.capacity(); }
+
+    Iterator begin() noexcept           { return dense.begin(); }
+    Iterator end() noexcept             { return dense.end(); }
+    ConstIterator begin() const noexcept { return dense.begin(); }
+    ConstIterator end() const noexcept   { return dense.end(); }
+
+private:
+    static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+    static constexpr std::size_t indexOf(Key id) noexcept {
+        return static_cast<std::uint32_t>(id);
+    }
+
+    std::vector<T>           dense;
+    std::vector<Key>         entities;
+    std::vector<std::size_t> sparse;
+};
+
+#endif
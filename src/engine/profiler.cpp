@@ -0,0 +1,134 @@
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <string_view>
+
+namespace Profiler
+{
+    namespace 
+    {
+        constexpr std::size_t SAMPLES  = 128;
+        constexpr int TYPES            = int(Enum::Type::PIPE) + 1;
+        constexpr int SECTIONS         = int(Section::END) + TYPES;
+
+        constexpr std::array<std::string_view, SECTIONS> NAMES {
+            "events", "render", "update", "physics", "camera",
+            "- mario", "- block", "- cloud", "- coin", "- fire", "- flower", 
+            "- goomba", "- mushroom", "- spiny", "- star", "- pipe"
+        };
+
+        // in nanoseconds, converted to ms only for the stats
+        std::array<Duration::rep, SECTIONS> current {};
+        std::array<std::array<Duration::rep, SAMPLES>, SECTIONS> history {};
+
+        std::size_t nextSample = 0;
+        std::size_t samples    = 0;
+
+        Stats computeStats(int index) noexcept
+        {
+            if(samples == 0) {
+                return Stats();
+            }
+
+            std::array<Duration::rep, SAMPLES> sorted = history[index];
+            std::sort(sorted.begin(), sorted.begin() + samples);
+
+            Duration::rep sum = 0;
+            for(std::size_t i = 0; i < samples; i++) {
+                sum += sorted[i];
+            }
+
+            const std::size_t p99 = std::min(samples - 1, samples * 99 / 100);
+
+            constexpr float NANOSECONDS_PER_MS = 1000000.f;
+
+            return Stats {
+                sorted[0] / NANOSECONDS_PER_MS,
+                (sum / float(samples)) / NANOSECONDS_PER_MS,
+                sorted[p99] / NANOSECONDS_PER_MS
+            };
+        }
+    } // namespace
+
+    void addTime(Section section, Duration time) noexcept {
+        current[int(section)] += time.count();
+    }
+
+    void addTime(Enum::Type type, Duration time) noexcept 
+    {
+        if(type != Enum::Type::NONE) {
+            current[int(Section::END) + int(type)] += time.count();
+        }
+    }
+
+    void endFrame() noexcept
+    {
+        for(int i = 0; i < SECTIONS; i++) 
+        {
+            history[i][nextSample] = current[i];
+            current[i] = 0;
+        }
+
+        nextSample = (nextSample + 1) % SAMPLES;
+        samples    = std::min(samples + 1, SAMPLES);
+    }
+
+    Stats getStats(Section section) noexcept {
+        return computeStats(int(section));
+    }
+
+    Stats getStats(Enum::Type type) noexcept {
+        return computeStats(int(Section::END) + int(type));
+    }
+
+    void print(std::ostream& out)
+    {
+        out << std::fixed << std::setprecision(3)
+            << std::left << std::setw(12) << "ms" << "   min      avg      p99\n";
+
+        for(int i = 0; i < SECTIONS; i++) 
+        {
+            const Stats stats = computeStats(i);
+            out << std::left << std::setw(12) << NAMES[i] << ' '
+                << std::right << std::setw(8) << stats.min << ' '
+                << std::setw(8) << stats.avg << ' '
+                << std::setw(8) << stats.p99 << '\n';
+        }
+    }
+
+    // ----------- Overlay ------------ //
+    void Overlay::draw(sf::RenderTarget& target)
+    {
+        if(not m_loaded) 
+        {
+            if(not m_font.loadFromFile("assets/SuperMario256.ttf")) {
+                return;
+            }
+
+            m_text.setFont(m_font);
+            m_text.setCharacterSize(10);
+            m_text.setFillColor(sf::Color::Black);
+            m_text.setPosition(5, 5);
+            m_loaded = true;
+        }
+
+        if(m_frames++ % REFRESH_FRAMES == 0) {
+            refresh();
+        }
+
+        // screen space, not affected by the camera
+        const sf::View view = target.getView();
+        target.setView(target.getDefaultView());
+        target.draw(m_text);
+        target.setView(view);
+    }
+
+    void Overlay::refresh()
+    {
+        std::ostringstream stream;
+        Profiler::print(stream);
+        m_text.setString(stream.str());
+    }
+} // namespace Profiler
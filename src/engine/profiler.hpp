@@ -0,0 +1,103 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <SFML/Graphics.hpp>
+
+#include <array>
+#include <chrono>
+#include <ostream>
+
+#include "helpers/enums.hpp"
+
+// ---------------------------------------------------------- //
+// Frame profiler
+// every section sums up the time spent in it during the frame,
+// the last SAMPLES frames are kept to get the min / avg / p99.
+// It's only recording when ENABLE_DEBUG_MODE is defined.
+// ---------------------------------------------------------- //
+namespace Profiler
+{
+    enum class Section : int {
+        EVENTS,
+        RENDER,
+        UPDATE,
+        PHYSICS,
+        CAMERA,
+        END
+    };
+
+    struct Stats
+    {
+        float min = 0; // all in ms
+        float avg = 0;
+        float p99 = 0;
+    };
+
+    // in nanoseconds, a scope can be a lot shorter than a microsecond
+    // and still add up to something when it runs for every entity
+    using Duration = std::chrono::nanoseconds;
+
+    void addTime(Section section, Duration time) noexcept;
+
+    // the update functions are broken down by the type of the entity
+    void addTime(Enum::Type type, Duration time) noexcept;
+
+    // moves the current frame into the history
+    void endFrame() noexcept;
+
+    Stats getStats(Section section) noexcept;
+    Stats getStats(Enum::Type type) noexcept;
+
+    void print(std::ostream& out);
+
+    // ----------- Scoped Timer ------------ //
+    template<typename Key>
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(Key key) noexcept 
+            : m_key(key), m_start(Clock::now()) {}
+
+        ~ScopedTimer() noexcept {
+            Profiler::addTime(m_key, std::chrono::duration_cast<Duration>(Clock::now() - m_start));
+        }
+
+    private:
+        // sf::Clock only counts microseconds
+        using Clock = std::chrono::steady_clock;
+
+        Key m_key;
+        Clock::time_point m_start;
+    };
+
+    // ----------- Overlay ------------ //
+    // draws the stats on the top left corner of the screen,
+    // the text is rebuilt only every REFRESH_FRAMES frames
+    class Overlay
+    {
+    public:
+        void draw(sf::RenderTarget& target);
+
+    private:
+        static constexpr unsigned int REFRESH_FRAMES = 30;
+
+        void refresh();
+
+        sf::Font m_font;
+        sf::Text m_text;
+        bool m_loaded = false;
+        unsigned int m_frames = 0;
+    };
+} // namespace Profiler
+
+#define PROFILER_CONCAT_IMPL(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_IMPL(a, b)
+
+// times the rest of the scope into `key` (a Profiler::Section or an Enum::Type)
+#ifdef ENABLE_DEBUG_MODE
+#define PROFILE_SCOPE(key) const Profiler::ScopedTimer PROFILER_CONCAT(profilerTimer, __LINE__)(key)
+#else
+#define PROFILE_SCOPE(key)
+#endif
+
+#endif
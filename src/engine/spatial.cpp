@@ -0,0 +1,291 @@
+#include "spatial.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+CellRange toCells(const sf::FloatRect& bounds, float cell_size) noexcept
+{
+    return CellRange {
+        static_cast<int>(std::floor(bounds.left / cell_size)),
+        static_cast<int>(std::floor(bounds.top / cell_size)),
+        static_cast<int>(std::floor((bounds.left + bounds.width) / cell_size)),
+        static_cast<int>(std::floor((bounds.top + bounds.height) / cell_size))
+    };
+}
+
+// ----------- SpatialGrid ------------ //
+void SpatialGrid::update(EntityID id, const sf::FloatRect& bounds)
+{
+    const CellRange range = toCells(bounds, cellSize);
+
+    if(ranges.contains(id)) 
+    {
+        auto& current = ranges.at(id);
+
+        // still inside of the same cells, nothing to do
+        if(current == range) {
+            return;
+        }
+
+        removeCells(id, current);
+        current = range;
+    } 
+    else {
+        ranges[id] = range;
+    }
+
+    insertCells(id, range);
+}
+
+void SpatialGrid::remove(EntityID id) noexcept
+{
+    if(ranges.contains(id)) 
+    {
+        removeCells(id, ranges.at(id));
+        ranges.erase(id);
+    }
+}
+
+bool SpatialGrid::contains(EntityID id) const noexcept {
+    return ranges.contains(id);
+}
+
+std::size_t SpatialGrid::getCellCount() const noexcept {
+    return cells.size();
+}
+
+std::size_t SpatialGrid::getCapacity() const noexcept
+{
+    // the cells are never erased, so this only goes up when something allocated
+    std::size_t capacity = cells.size() + cells.bucket_count() + ranges.capacity();
+    for(const auto& [key, ids] : cells) {
+        capacity += ids.capacity();
+    }
+
+    return capacity;
+}
+
+void SpatialGrid::query(const sf::FloatRect& area, std::vector<EntityID>& result) const
+{
+    const std::size_t begin = result.size();
+    const CellRange range   = toCells(area, cellSize);
+
+    for(int y = range.top; y <= range.bottom; y++)
+    {
+        for(int x = range.left; x <= range.right; x++)
+        {
+            if(auto cell = cells.find(key(x, y)); cell != cells.end()) {
+                result.insert(result.end(), cell->second.begin(), cell->second.end());
+            }
+        }
+    }
+
+    // big entities are inside of more than one cell
+    std::sort(result.begin() + begin, result.end());
+    result.erase(std::unique(result.begin() + begin, result.end()), result.end());
+}
+
+std::int64_t SpatialGrid::key(int x, int y) noexcept {
+    // shifted unsigned, shifting a negative cell is undefined
+    const std::uint64_t high = static_cast<std::uint32_t>(x);
+    return static_cast<std::int64_t>((high << 32) | static_cast<std::uint32_t>(y));
+}
+
+void SpatialGrid::insertCells(EntityID id, const CellRange& range)
+{
+    for(int y = range.top; y <= range.bottom; y++)
+    {
+        for(int x = range.left; x <= range.right; x++) {
+            cells[key(x, y)].push_back(id);
+        }
+    }
+}
+
+void SpatialGrid::removeCells(EntityID id, const CellRange& range) noexcept
+{
+    for(int y = range.top; y <= range.bottom; y++)
+    {
+        for(int x = range.left; x <= range.right; x++)
+        {
+            if(auto cell = cells.find(key(x, y)); cell != cells.end())
+            {
+                auto& ids = cell->second;
+                if(auto it = std::find(ids.begin(), ids.end(), id); it != ids.end()) 
+                {
+                    *it = ids.back();
+                    ids.pop_back();
+                }
+            }
+        }
+    }
+}
+
+// ----------- TileGrid ------------ //
+void TileGrid::update(EntityID id, const sf::FloatRect& area)
+{
+    const CellRange range = toCells(area, tileSize);
+
+    if(ranges.contains(id)) 
+    {
+        auto& current = ranges.at(id);
+
+        // still on the same tiles, nothing to do
+        if(current == range) {
+            return;
+        }
+
+        removeCells(id, current);
+        current = range;
+    } 
+    else {
+        ranges[id] = range;
+    }
+
+    insertCells(id, range);
+}
+
+void TileGrid::remove(EntityID id) noexcept
+{
+    if(ranges.contains(id)) 
+    {
+        removeCells(id, ranges.at(id));
+        ranges.erase(id);
+    }
+}
+
+bool TileGrid::contains(EntityID id) const noexcept {
+    return ranges.contains(id);
+}
+
+std::size_t TileGrid::getCellCount() const noexcept {
+    return cells.size();
+}
+
+std::size_t TileGrid::getCapacity() const noexcept
+{
+    std::size_t capacity = cells.capacity() + ranges.capacity();
+    for(const auto& ids : cells) {
+        capacity += ids.capacity();
+    }
+
+    return capacity;
+}
+
+void TileGrid::query(const sf::FloatRect& area, std::vector<EntityID>& result) const
+{
+    const std::size_t begin = result.size();
+    const CellRange range   = toCells(area, tileSize);
+    const int width         = bounds.right - bounds.left + 1;
+
+    // only the part that is inside of the level
+    const int left   = std::max(range.left, bounds.left);
+    const int top    = std::max(range.top, bounds.top);
+    const int right  = std::min(range.right, bounds.right);
+    const int bottom = std::min(range.bottom, bounds.bottom);
+
+    for(int y = top; y <= bottom; y++)
+    {
+        for(int x = left; x <= right; x++)
+        {
+            const auto& ids = cells[(y - bounds.top) * width + (x - bounds.left)];
+            result.insert(result.end(), ids.begin(), ids.end());
+        }
+    }
+
+    // an entity that isn't on the lattice is on more than one tile
+    std::sort(result.begin() + begin, result.end());
+    result.erase(std::unique(result.begin() + begin, result.end()), result.end());
+}
+
+std::vector<EntityID>& TileGrid::cellAt(int x, int y) noexcept
+{
+    const int width = bounds.right - bounds.left + 1;
+    return cells[(y - bounds.top) * width + (x - bounds.left)];
+}
+
+void TileGrid::grow(const CellRange& range)
+{
+    const bool empty = cells.empty();
+    const CellRange grown {
+        empty ? range.left   : std::min(range.left, bounds.left),
+        empty ? range.top    : std::min(range.top, bounds.top),
+        empty ? range.right  : std::max(range.right, bounds.right),
+        empty ? range.bottom : std::max(range.bottom, bounds.bottom)
+    };
+
+    const int width = grown.right - grown.left + 1;
+    std::vector<std::vector<EntityID>> grownCells((grown.bottom - grown.top + 1) * width);
+
+    for(int y = bounds.top; not empty && y <= bounds.bottom; y++)
+    {
+        for(int x = bounds.left; x <= bounds.right; x++) {
+            grownCells[(y - grown.top) * width + (x - grown.left)] = std::move(cellAt(x, y));
+        }
+    }
+
+    cells  = std::move(grownCells);
+    bounds = grown;
+}
+
+void TileGrid::insertCells(EntityID id, const CellRange& range)
+{
+    if(cells.empty() || range.left < bounds.left || range.top < bounds.top || 
+       range.right > bounds.right || range.bottom > bounds.bottom) 
+    {
+        grow(range);
+    }
+
+    for(int y = range.top; y <= range.bottom; y++)
+    {
+        for(int x = range.left; x <= range.right; x++) {
+            cellAt(x, y).push_back(id);
+        }
+    }
+}
+
+void TileGrid::removeCells(EntityID id, const CellRange& range) noexcept
+{
+    for(int y = range.top; y <= range.bottom; y++)
+    {
+        for(int x = range.left; x <= range.right; x++)
+        {
+            auto& ids = cellAt(x, y);
+            if(auto it = std::find(ids.begin(), ids.end(), id); it != ids.end()) 
+            {
+                *it = ids.back();
+                ids.pop_back();
+            }
+        }
+    }
+}
+
+namespace Spatial
+{
+    void update(EntityID id, const sf::FloatRect& bounds)
+    {
+        if(tiles.contains(id)) {
+            tiles.update(id, bounds);
+        } 
+        else {
+            grid.update(id, bounds);
+        }
+    }
+
+    void makeStatic(EntityID id, const sf::FloatRect& bounds)
+    {
+        grid.remove(id);
+        tiles.update(id, bounds);
+    }
+
+    void remove(EntityID id) noexcept
+    {
+        grid.remove(id);
+        tiles.remove(id);
+    }
+
+    void query(const sf::FloatRect& area, std::vector<EntityID>& result)
+    {
+        tiles.query(area, result);
+        grid.query(area, result);
+    }
+} // namespace Spatial
@@ -0,0 +1,122 @@
+#ifndef SPATIAL_HPP
+#define SPATIAL_HPP
+
+#include <SFML/Graphics.hpp>
+
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+#include "components.hpp"
+#include "pool.hpp"
+#include "helpers/values.hpp"
+
+// the cells that some bounds overlap, inclusive on all of the sides
+struct CellRange 
+{
+    int left, top, right, bottom;
+
+    bool operator==(const CellRange& other) const noexcept {
+        return left == other.left && top == other.top && right == other.right && bottom == other.bottom;
+    }
+};
+
+CellRange toCells(const sf::FloatRect& bounds, float cell_size) noexcept;
+
+// ---------------------------------------------------------- //
+// Uniform spatial hash grid
+// every entity is stored in all of the cells its bounds overlap,
+// so asking for an area only walks the cells around it instead
+// of every entity in the level.
+// ---------------------------------------------------------- //
+class SpatialGrid
+{
+public:
+    explicit SpatialGrid(float cell_size) noexcept
+        : cellSize(cell_size) {}
+
+    void update(EntityID id, const sf::FloatRect& bounds);
+    void remove(EntityID id) noexcept;
+    bool contains(EntityID id) const noexcept;
+    std::size_t getCellCount() const noexcept;
+
+    // cells + buckets + every cell's entities + the ranges
+    std::size_t getCapacity() const noexcept;
+
+    // appends every entity around `area` to `result` (sorted and without duplicates)
+    void query(const sf::FloatRect& area, std::vector<EntityID>& result) const;
+
+private:
+    static std::int64_t key(int x, int y) noexcept;
+
+    void insertCells(EntityID id, const CellRange& range);
+    void removeCells(EntityID id, const CellRange& range) noexcept;
+
+    std::unordered_map<std::int64_t, std::vector<EntityID>> cells;
+    Pool<EntityID, CellRange> ranges;
+    float cellSize;
+};
+
+// ---------------------------------------------------------- //
+// Dense tile grid
+// the static geometry sits on the tile lattice of the level, so
+// its cells are one array over the tiles the level covers and a
+// lookup is indexing it by (x / TILE_SIZE, y / TILE_SIZE), without
+// hashing. the array grows when a tile is added outside of it,
+// which only happens while the level is being created.
+// ---------------------------------------------------------- //
+class TileGrid
+{
+public:
+    explicit TileGrid(float tile_size) noexcept
+        : tileSize(tile_size) {}
+
+    void update(EntityID id, const sf::FloatRect& area);
+    void remove(EntityID id) noexcept;
+    bool contains(EntityID id) const noexcept;
+    std::size_t getCellCount() const noexcept;
+
+    // the tiles + every tile's entities + the ranges
+    std::size_t getCapacity() const noexcept;
+
+    // appends every entity around `area` to `result` (sorted and without duplicates)
+    void query(const sf::FloatRect& area, std::vector<EntityID>& result) const;
+
+private:
+    std::vector<EntityID>& cellAt(int x, int y) noexcept;
+
+    // lays the tiles out again so `range` is inside of them
+    void grow(const CellRange& range);
+
+    void insertCells(EntityID id, const CellRange& range);
+    void removeCells(EntityID id, const CellRange& range) noexcept;
+
+    // row by row, `bounds` is the area of the level they cover
+    std::vector<std::vector<EntityID>> cells;
+    CellRange bounds { 0, 0, -1, -1 };
+
+    Pool<EntityID, CellRange> ranges;
+    float tileSize;
+};
+
+// ---------------------------------------------------------- //
+// Two collision layers:
+// `grid`  - entities that move, re-indexed every time they move
+// `tiles` - static geometry (blocks, coins, clouds) indexed once
+//           when the level is created, looked up tile by tile
+// ---------------------------------------------------------- //
+namespace Spatial 
+{
+    inline SpatialGrid grid(SPATIAL_CELL_SIZE);
+    inline TileGrid tiles(TILE_SIZE);
+
+    // re-index the entity in the layer it belongs to
+    void update(EntityID id, const sf::FloatRect& bounds);
+    void makeStatic(EntityID id, const sf::FloatRect& bounds);
+    void remove(EntityID id) noexcept;
+
+    // appends the static geometry and then the moving entities around `area`
+    void query(const sf::FloatRect& area, std::vector<EntityID>& result);
+} // namespace Spatial
+
+#endif
@@ -2,11 +2,19 @@
 #include "helpers/values.hpp"
 #include "helpers/functions.hpp"
 #include "manager.hpp"
+#include "spatial.hpp"
+#include "profiler.hpp"
+#include "jobs.hpp"
+#include "aabb.hpp"
+#include "timers.hpp"
 #include "../entities/entities.hpp"
 
 #include <exception>
+#include <algorithm>
 #include <cmath>
 #include <vector>
+#include <array>
+#include <cstdint>
 
 namespace System
 {
@@ -14,81 +22,462 @@ namespace System
     void Render::draw(EntityID id) noexcept 
     {
         if(Manager::canAccess(id)) {
-            m_window.draw(System::Base::getSprite(id));
+            m_target.draw(Component::bases.at(id).sprite);
         }
     }
 
-    void Render::drawAll() noexcept 
+    void Render::drawAll(float interpolation) noexcept 
     {
-        for(auto[id, base] : Component::bases)
+        for(auto& batch : m_batches) {
+            batch.vertices.clear();
+        }
+
+        const sf::View& view = m_target.getView();
+        const sf::FloatRect viewRect(view.getCenter() - view.getSize() / 2.f, view.getSize());
+
+        // the spatial grid is only up to date after this
+        Base::updateDirtyBounds();
+
+        m_visible.clear();
+        Spatial::query(viewRect, m_visible);
+
+        // keep the order of creation between the two collision layers
+        std::sort(m_visible.begin(), m_visible.end());
+
+        for(const EntityID id : m_visible) 
         {
-            if(Manager::canAccess(id)) {
-                m_window.draw(base.sprite);   
+            const auto& base = Component::bases.at(id);
+            const sf::Vector2f offset = (base.previousPosition - base.sprite.getPosition()) * (1.f - interpolation);
+
+            addToBatch(base.sprite, offset);
+        }
+
+        // the bases without a type (the parked fires of the pool)
+        // are not in the world, so they aren't culled either
+        std::size_t typed = 0;
+        for(const auto& members : Component::typeMembers) {
+            typed += members.size();
+        }
+
+        m_stats.drawn  = m_visible.size();
+        m_stats.culled = typed - std::min(typed, m_visible.size());
+
+        for(auto& batch : m_batches)
+        {
+            batch.mostVertices = std::max(batch.mostVertices, batch.vertices.getVertexCount());
+
+            if(batch.vertices.getVertexCount() > 0) {
+                m_target.draw(batch.vertices, batch.texture);
             }
         }
     }
 
+    std::size_t Render::getCapacity() const noexcept
+    {
+        std::size_t capacity = m_visible.capacity() + m_batches.capacity();
+        for(const auto& batch : m_batches) {
+            capacity += batch.mostVertices;
+        }
+
+        return capacity;
+    }
+
+    void Render::addToBatch(const sf::Sprite& sprite, const sf::Vector2f& offset)
+    {
+        const sf::Texture* texture = sprite.getTexture();
+        if(texture == nullptr) {
+            return;
+        }
+
+        auto batch = std::find_if(m_batches.begin(), m_batches.end(), [texture](const Batch& b) { 
+            return b.texture == texture; 
+        });
+
+        if(batch == m_batches.end()) 
+        {
+            m_batches.push_back(Batch { texture, sf::VertexArray(sf::Triangles) });
+            batch = m_batches.end() - 1;
+        }
+
+        // same as sf::Sprite does it, but in world coordinates
+        const sf::Transform transform = sf::Transform().translate(offset) * sprite.getTransform();
+        const sf::FloatRect  bounds    = sprite.getLocalBounds();
+        const sf::IntRect    rect      = sprite.getTextureRect();
+        const sf::Color      color     = sprite.getColor();
+
+        const float left   = static_cast<float>(rect.left);
+        const float right  = left + rect.width;
+        const float top    = static_cast<float>(rect.top);
+        const float bottom = top + rect.height;
+
+        const sf::Vertex topLeft    (transform.transformPoint(0, 0),                        color, sf::Vector2f(left, top));
+        const sf::Vertex bottomLeft (transform.transformPoint(0, bounds.height),            color, sf::Vector2f(left, bottom));
+        const sf::Vertex topRight   (transform.transformPoint(bounds.width, 0),             color, sf::Vector2f(right, top));
+        const sf::Vertex bottomRight(transform.transformPoint(bounds.width, bounds.height), color, sf::Vector2f(right, bottom));
+
+        auto& vertices = batch->vertices;
+        vertices.append(topLeft);
+        vertices.append(bottomLeft);
+        vertices.append(topRight);
+        vertices.append(topRight);
+        vertices.append(bottomLeft);
+        vertices.append(bottomRight);
+    }
+
 
     // ----------- Game Loop ------------ //
     namespace Game
     {
+        namespace 
+        {
+            // destroyed at the end of the current updateAll
+            std::vector<EntityID> removeQueue;
+
+            // waiting for their animation to finish before joining the queue
+            std::vector<EntityID> pendingRemovals;
+
+            std::vector<std::pair<Enum::Type, SystemFunction>> systems;
+
+            // indexed by Enum::Type
+            std::array<RecycleFunction, Enum::TYPE_COUNT> recyclers {};
+        } // namespace
+
+        void addSystem(Enum::Type type, SystemFunction system) noexcept {
+            systems.emplace_back(type, system);
+        }
+
         void update(EntityID id) noexcept 
         {
-            if(Manager::canAccess(id)) 
+            if(Component::updates.contains(id)) {
+                Component::updates.at(id)(id);
+            }
+        }
+
+        void updateAll() noexcept 
+        {
+            Activation::update();
+            Physics::startAll();
+
+            // after physics, so a jump of N ticks goes up N times
+            Timers::advance();
+            Animation::playAll();
+
+            for(const auto& [type, system] : systems)
+            {
+                PROFILE_SCOPE(type);
+                system();
+            }
+
+            // updates can create entities which can grow the pool,
+            // so the function pointer is copied before calling it
+            Activation::each(Component::updates, [](EntityID id, Component::UpdateFunction update)
             {
-                auto& update = Component::updates[id];
+                PROFILE_SCOPE(Component::types.at(id).type);
                 update(id);
+            });
+
+            processRemovals();
+        }
+
+        void setRecycler(Enum::Type type, RecycleFunction recycle) noexcept {
+            recyclers[std::size_t(type)] = recycle;
+        }
+
+        void removeID(EntityID id, WAIT_FOR_ANIM wait_for_anim) noexcept 
+        {
+            if(wait_for_anim == WAIT_FOR_ANIM::FALSE) {
+                removeQueue.push_back(id);
+            }
+            else if(std::find(pendingRemovals.begin(), pendingRemovals.end(), id) == pendingRemovals.end()) {
+                pendingRemovals.push_back(id);
             }
         }
 
-        void updateAll() noexcept 
+        void processRemovals() noexcept
         {
-            for(auto[id, update] : Component::updates)
+            // the ones that finished their animation join the queue,
+            // and the ones that were already removed are dropped.
+            // a parked one isn't animated, and nobody would see it anyway
+            const auto done = std::remove_if(pendingRemovals.begin(), pendingRemovals.end(), [](EntityID id)
             {
-                if(Manager::canAccess(id)) {
-                    update(id);
+                if(not Manager::canAccess(id)) {
+                    return true;
+                }
+
+                if(not Activation::isActive(id) || Animation::getAnimationFinished(id)) 
+                {
+                    removeQueue.push_back(id);
+                    return true;
                 }
+
+                return false;
+            });
+            pendingRemovals.erase(done, pendingRemovals.end());
+
+            if(removeQueue.empty()) {
+                return;
             }
 
-            /* first  = EntityID
-               second = waiting for animation*/
-            for(auto& i : removeableIDS) 
+            // the same entity can be asked to be removed more than once in a tick
+            std::sort(removeQueue.begin(), removeQueue.end());
+            removeQueue.erase(std::unique(removeQueue.begin(), removeQueue.end()), removeQueue.end());
+
+            // the types that are being reused take theirs back, they are
+            // moved to the end first and handed to their recycler after
+            const auto recycled = std::partition(removeQueue.begin(), removeQueue.end(), [](EntityID id)
             {
-                if(Manager::canAccess(i.first)) 
-                {
-                    if(i.second == true) 
-                    {
-                        if(Animation::getAnimationFinished(i.first) == true) {
-                            Manager::remove(i.first);
-                        }
-                    } 
-                    else {
-                        Manager::remove(i.first);
-                    }
+                if(not Manager::canAccess(id)) {
+                    return true;
                 }
+
+                const Enum::Type type = Component::types.at(id).type;
+                return type == Enum::Type::NONE || recyclers[std::size_t(type)] == nullptr;
+            });
+
+            for(auto it = recycled; it != removeQueue.end(); it++) {
+                recyclers[std::size_t(Component::types.at(*it).type)](*it);
             }
+            removeQueue.erase(recycled, removeQueue.end());
+
+            // partition doesn't keep the order
+            std::sort(removeQueue.begin(), removeQueue.end());
+
+            Manager::removeBatch(removeQueue);
+            removeQueue.clear();
         }
 
-        void removeID(EntityID id, WAIT_FOR_ANIM wait_for_anim) noexcept {
-            removeableIDS.push_back( std::make_pair(id, bool(wait_for_anim)) );
+        std::size_t getPendingRemovals() noexcept {
+            return pendingRemovals.size();
+        }
+
+        std::size_t getCapacity() noexcept {
+            return removeQueue.capacity() + pendingRemovals.capacity() + systems.capacity();
         }
     } // namespace Game
 
+    // --------- Activation ----------------- //
+    namespace Activation
+    {
+        namespace
+        {
+            sf::FloatRect region;
+            bool limited = false;
+
+            ComponentMemberSet active;
+            std::array<ComponentMemberSet, Enum::TYPE_COUNT> activeMembers;
+
+            std::vector<EntityID> found;
+            std::vector<EntityID> kept;
+        } // namespace
+
+        void setRegion(const sf::FloatRect& view, float margin) noexcept
+        {
+            region  = sf::FloatRect(view.left - margin, view.top - margin, view.width + margin * 2, view.height + margin * 2);
+            limited = true;
+        }
+
+        void clearRegion() noexcept {
+            limited = false;
+        }
+
+        bool isLimited() noexcept {
+            return limited;
+        }
+
+        void keepActive(EntityID id) {
+            kept.push_back(id);
+        }
+
+        void update()
+        {
+            if(not limited) {
+                return;
+            }
+
+            // the spatial grid is only up to date after this
+            Base::updateDirtyBounds();
+
+            found.clear();
+            Spatial::query(region, found);
+
+            kept.erase(std::remove_if(kept.begin(), kept.end(), [](EntityID id) { 
+                return not Manager::canAccess(id); 
+            }), kept.end());
+            found.insert(found.end(), kept.begin(), kept.end());
+
+            // the same order every time, no matter which layer they came from
+            std::sort(found.begin(), found.end());
+            found.erase(std::unique(found.begin(), found.end()), found.end());
+
+            active.clear();
+            for(auto& members : activeMembers) {
+                members.clear();
+            }
+
+            for(const EntityID id : found)
+            {
+                active[id] = id;
+
+                if(const Enum::Type type = Component::types.at(id).type; type != Enum::Type::NONE) {
+                    activeMembers[std::size_t(type)][id] = id;
+                }
+            }
+        }
+
+        bool isActive(EntityID id) noexcept {
+            return not limited || active.contains(id);
+        }
+
+        const ComponentMemberSet& getEntities(Enum::Type type) noexcept 
+        {
+            if(not limited) {
+                return Component::typeMembers[std::size_t(type)];
+            }
+
+            return activeMembers[std::size_t(type)];
+        }
+
+        const ComponentMemberSet& getEntities() noexcept {
+            return active;
+        }
+
+        std::size_t getCapacity() noexcept
+        {
+            std::size_t capacity = active.capacity() + found.capacity() + kept.capacity();
+            for(const auto& members : activeMembers) {
+                capacity += members.capacity();
+            }
+
+            return capacity;
+        }
+
+        namespace Helper
+        {
+            void wake(EntityID id, Enum::Type previous, Enum::Type type)
+            {
+                if(not limited) {
+                    return;
+                }
+
+                if(previous != Enum::Type::NONE) {
+                    activeMembers[std::size_t(previous)].erase(id);
+                }
+
+                // a new entity is simulated right away, it's parked
+                // on the next update if it's outside of the region
+                active[id] = id;
+                if(type != Enum::Type::NONE) {
+                    activeMembers[std::size_t(type)][id] = id;
+                }
+            }
+        } // namespace Helper
+    } // namespace Activation
+
     // --------- Base ----------------- //
     namespace Base
     {
+        namespace 
+        {
+            // the entities whose sprite might have changed since their bounds were computed
+            std::vector<EntityID> dirtyBounds;
+
+            void markDirty(EntityID id, Component::Base& base)
+            {
+                if(not base.boundsDirty) 
+                {
+                    base.boundsDirty = true;
+                    dirtyBounds.push_back(id);
+                }
+            }
+
+            void computeBounds(EntityID id, Component::Base& base) noexcept
+            {
+                base.bounds = base.sprite.getGlobalBounds();
+                base.boundsDirty = false;
+                Spatial::update(id, base.bounds);
+            }
+        } // namespace
+
         void setState(EntityID id, Enum::State state) noexcept
         {
             auto& base = Component::bases[id];
             base.state = state;
         }
 
+        void setPosition(EntityID id, const sf::Vector2f& position) noexcept
+        {
+            auto& base = Component::bases[id];
+            base.sprite.setPosition(position);
+
+            // teleporting, there is nothing to interpolate from
+            base.previousPosition = position;
+            markDirty(id, base);
+        }
+
+        void move(EntityID id, const sf::Vector2f& offset) noexcept
+        {
+            auto& base = Component::bases[id];
+            base.sprite.move(offset);
+            markDirty(id, base);
+        }
+
+        void setTextureRect(EntityID id, const sf::IntRect& rect) noexcept
+        {
+            auto& base = Component::bases[id];
+            base.sprite.setTextureRect(rect);
+            markDirty(id, base);
+        }
+
+        void updateDirtyBounds() noexcept
+        {
+            for(const EntityID id : dirtyBounds)
+            {
+                if(Component::bases.contains(id)) 
+                {
+                    auto& base = Component::bases.at(id);
+                    if(base.boundsDirty) {
+                        computeBounds(id, base);
+                    }
+                }
+            }
+
+            dirtyBounds.clear();
+        }
+
+        void setStatic(EntityID id) noexcept {
+            Spatial::makeStatic(id, System::Base::getBounds(id));
+        }
+
+        void savePreviousPositions() noexcept
+        {
+            for(auto& base : Component::bases) {
+                base.previousPosition = base.sprite.getPosition();
+            }
+        }
+
         sf::Sprite& getSprite(EntityID id) noexcept
         {
+            // it can be changed through the reference
             auto& base = Component::bases[id];
+            markDirty(id, base);
+
             return base.sprite;
         }
 
+        const sf::Vector2f& getPosition(EntityID id) noexcept {
+            return Component::bases.at(id).sprite.getPosition();
+        }
+
+        const sf::FloatRect& getBounds(EntityID id) noexcept 
+        {
+            auto& base = Component::bases.at(id);
+            if(base.boundsDirty) {
+                computeBounds(id, base);
+            }
+
+            return base.bounds;
+        }
+
         Enum::State& getState(EntityID id)
         {
             auto& base = Component::bases[id];
@@ -98,6 +487,10 @@ namespace System
 
             return base.state.value();
         }
+
+        std::size_t getCapacity() noexcept {
+            return dirtyBounds.capacity();
+        }
     }
 
     // --------- Type ----------------- //
@@ -106,7 +499,16 @@ namespace System
         void setType(EntityID id, Enum::Type type) noexcept
         {
             auto& r_type = Component::types[id];
+            if(r_type.type != Enum::Type::NONE) {
+                Component::typeMembers[std::size_t(r_type.type)].erase(id);
+            }
+
+            Activation::Helper::wake(id, r_type.type, type);
+
             r_type.type = type;
+            if(type != Enum::Type::NONE) {
+                Component::typeMembers[std::size_t(type)][id] = id;
+            }
         }
 
         void setWhatType(EntityID id, BlockPair&& block_pair) noexcept
@@ -127,6 +529,10 @@ namespace System
             return type.type;
         }
 
+        const ComponentMemberSet& getEntities(Enum::Type type) noexcept {
+            return Component::typeMembers[std::size_t(type)];
+        }
+
         const BlockPair& getBlockPair(EntityID id) noexcept
         {
             const auto& type = Component::types[id];
@@ -143,22 +549,10 @@ namespace System
     // ----------- Animation ------------ //
     namespace Animation 
     {
-        void setFrames(EntityID id, int pos, const AnimationVector& anims) noexcept 
-        {
-            auto& animation = Component::animations[id];
-            animation.animations[pos] = anims;
-        }
-
-        void setFrames(EntityID id, int pos, const sf::IntRect& anim) noexcept 
+        void setClips(EntityID id, Clips::SetID clips) noexcept 
         {
             auto& animation = Component::animations[id];
-            animation.animations[pos] = { anim };
-        }
-
-        void addFrame(EntityID id, int pos, const sf::IntRect& anim) noexcept
-        {
-            auto& animation = Component::animations[id];
-            animation.animations[pos].push_back(anim);
+            animation.clips = clips;
         }
 
         void setCurrentAnimation(EntityID id, int pos) noexcept 
@@ -166,7 +560,7 @@ namespace System
             auto& animation = Component::animations[id];
             
             // make sure position exists
-            if(animation.animations.find(pos) != animation.animations.end()) 
+            if(const Clips::ClipID clip = Clips::getClip(animation.clips, pos); clip != Clips::NO_CLIP) 
             { 
                 if(pos != animation.currentAnimation) 
                 {
@@ -174,9 +568,11 @@ namespace System
                     Animation::setFinished(id, false);
 
                     animation.currentAnimation = pos;
+                    animation.clip = clip;
 
                     // Set the first frame to sprite
-                    System::Base::getSprite(id).setTextureRect(animation.animations[pos][0]);
+                    animation.shownFrame = 0;
+                    System::Base::setTextureRect(id, Clips::getFrame(Clips::get(clip), 0));
                 }
             }
             #ifdef ENABLE_DEBUG_MODE
@@ -189,7 +585,7 @@ namespace System
         void setNextAnimationTimer(EntityID id, unsigned int next_animation_timer = 500) noexcept
         {
             auto& animation = Component::animations[id];
-            animation.nextFrameTimer = next_animation_timer;
+            animation.frameTicks = millisecondsToTicks(next_animation_timer);
         }
 
         void setStopWhenFinished(EntityID id, bool stop) noexcept
@@ -216,36 +612,14 @@ namespace System
             animation.isFinished = finished;
         }
 
-        void play(EntityID id) noexcept 
+        void playAll() noexcept 
         {
-            auto& animation = Component::animations[id];
-
-            if(animation.allowPlay)
+            Activation::each(Component::animations, [](EntityID id, Component::Animation& animation) 
             {
-                const int maxFrames = animation.animations[animation.currentAnimation].size();
-                Animation::setStarted(id, true);
-
-                if(sf::Time timer = animation.clock.getElapsedTime();
-                    timer >= sf::milliseconds(animation.nextFrameTimer))
-                {
-                    if(animation.currentFrame >= maxFrames) 
-                    {
-                        animation.currentFrame = 0;
-                        Animation::setFinished(id, true);
-                    }
-
-                    // get out of the function before setting a different frame
-                    if(animation.isFinished && animation.stopWhenFinished) {
-                        return;
-                    }
-
-                    // set the current frame
-                    System::Base::getSprite(id).setTextureRect(animation.animations[animation.currentAnimation][animation.currentFrame]);
-
-                    animation.currentFrame++;
-                    animation.clock.restart();
+                if(Helper::advance(animation)) {
+                    System::Base::setTextureRect(id, Clips::getFrame(Clips::get(animation.clip), animation.shownFrame));
                 }
-            }
+            });
         }
 
         bool getAnimationFinished(EntityID id) noexcept
@@ -254,16 +628,6 @@ namespace System
             return animation.isFinished;
         }
 
-        const AnimationVector& getFrames(EntityID id, int pos)
-        {
-            const auto& animation = Component::animations[id];
-            if(animation.animations.find(pos) == animation.animations.end()) { 
-                throw std::runtime_error("Animation Vector doesn't exists!");
-            }
-
-            return animation.animations.at(pos);
-        }   
-
         int getCurrentAnimation(EntityID id) noexcept
         {
             const auto& animation = Component::animations[id];
@@ -290,6 +654,48 @@ namespace System
                 const int height = std::abs(rect.top - rect.height);
                 return sf::IntRect(rect.left, rect.top, width, height);
             }
+
+            bool advance(Component::Animation& animation) noexcept
+            {
+                // the time is counted even when it's not allowed to play,
+                // the first frame shows up right away once it is
+                if(animation.elapsedTicks < animation.frameTicks) {
+                    animation.elapsedTicks++;
+                }
+
+                if(not animation.allowPlay) {
+                    return false;
+                }
+
+                animation.isStarted = true;
+
+                // nothing was set to play yet
+                if(animation.clip == Clips::NO_CLIP || animation.elapsedTicks < animation.frameTicks) {
+                    return false;
+                }
+
+                if(animation.currentFrame >= Clips::get(animation.clip).count) 
+                {
+                    animation.currentFrame = 0;
+                    animation.isFinished = true;
+                }
+
+                // get out of the function before setting a different frame
+                if(animation.isFinished && animation.stopWhenFinished) {
+                    return false;
+                }
+
+                const std::uint16_t frame = animation.currentFrame++;
+                animation.elapsedTicks = 0;
+
+                // the same rect is already on the sprite
+                if(frame == animation.shownFrame) {
+                    return false;
+                }
+
+                animation.shownFrame = frame;
+                return true;
+            }
         } // namespace Helper
 
     } // namespace Animation
@@ -299,7 +705,7 @@ namespace System
     {
         void moveRight(EntityID id, float speed) noexcept
         {
-            System::Base::getSprite(id).move(sf::Vector2f(speed, 0));
+            System::Base::move(id, sf::Vector2f(speed, 0));
             
             Movement::setMoving(id, true);
             Movement::setLookingDirection(id, Enum::Direction::RIGHT);
@@ -307,7 +713,7 @@ namespace System
 
         void moveRight(EntityID id, float speed, Enum::Animation anim) noexcept
         {
-            System::Base::getSprite(id).move(sf::Vector2f(speed, 0));
+            System::Base::move(id, sf::Vector2f(speed, 0));
 
             Animation::setCurrentAnimation(id, int(anim));
 
@@ -317,7 +723,7 @@ namespace System
 
         void moveLeft(EntityID id, float speed) noexcept
         {
-            System::Base::getSprite(id).move(sf::Vector2f(-speed, 0));
+            System::Base::move(id, sf::Vector2f(-speed, 0));
 
             Movement::setMoving(id, true);
             Movement::setLookingDirection(id, Enum::Direction::LEFT);
@@ -325,7 +731,7 @@ namespace System
 
         void moveLeft(EntityID id, float speed, Enum::Animation anim) noexcept
         {
-            System::Base::getSprite(id).move(sf::Vector2f(-speed, 0));
+            System::Base::move(id, sf::Vector2f(-speed, 0));
 
             Animation::setCurrentAnimation(id, int(anim));
 
@@ -337,7 +743,7 @@ namespace System
         void jump(EntityID id, unsigned int height, FORCE force)
         {
             #ifdef ENABLE_DEBUG_MODE
-            if(Component::physics.find(id) == Component::physics.end()) {
+            if(not Component::physics.contains(id)) {
                 throw std::runtime_error("Please add physics component to enable jumping!");
             }
             #endif
@@ -347,16 +753,14 @@ namespace System
             {
                 Movement::setJumping(id, true);
 
-                auto& physics = Component::physics[id];
-                physics.maxJumpHeight = height;
-                physics.jumpClock.restart();
+                Movement::Helper::startJumpTimer(id, height);
             }
         }
 
         void jump(EntityID id, unsigned int height, Enum::Animation anim, FORCE force)
         {
             #ifdef ENABLE_DEBUG_MODE
-            if(Component::physics.find(id) == Component::physics.end()) {
+            if(not Component::physics.contains(id)) {
                 throw std::runtime_error("Please add physics component to enable jumping!");
             }
             #endif
@@ -366,9 +770,7 @@ namespace System
             {
                 Movement::setJumping(id, true);
                 
-                auto& physics = Component::physics[id];
-                physics.maxJumpHeight = height;
-                physics.jumpClock.restart();
+                Movement::Helper::startJumpTimer(id, height);
             }
         }
 
@@ -431,61 +833,265 @@ namespace System
             const auto& movement = Component::movements[id];
             return movement.isMoving;
         }
+
+        namespace Helper
+        {
+            void startJumpTimer(EntityID id, unsigned int height)
+            {
+                auto& physics = Component::physics[id];
+                physics.maxJumpHeight = height;
+
+                // a forced jump starts over
+                Timers::cancel(physics.jumpTimer);
+                physics.jumpTimer = Timers::schedule(id, millisecondsToTicks(height), [](EntityID jumper) {
+                    Movement::setJumping(jumper, false);
+                });
+            }
+        } // namespace Helper
     } // namespace Movement
 
     // ----------- Physics ------------ //
     namespace Physics
     {
-        void start(EntityID id) noexcept
+        namespace 
         {
-            bool touchingGround = false;
-            Enum::Direction blockedDirection = Enum::Direction::NONE;
+            using HandlerTable = std::array<std::array<CollisionHandler, Enum::TYPE_COUNT>, Enum::TYPE_COUNT>;
+
+            // [type of the one that moved][type of the one it touched]
+            HandlerTable collisionHandlers = [] 
+            {
+                HandlerTable table {};
+                const auto set = [&table](Enum::Type a, Enum::Type b, CollisionHandler handler) {
+                    table[std::size_t(a)][std::size_t(b)] = handler;
+                };
+
+                // Entities
+                set(Enum::Type::MARIO, Enum::Type::COIN,     Helper::checkTouchedCoin);
+                set(Enum::Type::MARIO, Enum::Type::BLOCK,    Helper::checkTouchedBlock);
+                set(Enum::Type::MARIO, Enum::Type::MUSHROOM, Helper::checkTouchedMushroom);
+                set(Enum::Type::MARIO, Enum::Type::FLOWER,   Helper::checkTouchedFlower);
+
+                // Enemies
+                set(Enum::Type::MARIO, Enum::Type::GOOMBA,   Helper::checkTouchedGoomba);
+                set(Enum::Type::MARIO, Enum::Type::SPINY,    Helper::checkTouchedSpiny);
+                set(Enum::Type::FIRE,  Enum::Type::GOOMBA,   Helper::fireTouchedEnemy);
+                set(Enum::Type::FIRE,  Enum::Type::SPINY,    Helper::fireTouchedEnemy);
+
+                return table;
+            }();
+
+            CollisionHandler getCollisionHandler(EntityID id, EntityID second_id) noexcept
+            {
+                const Enum::Type type       = Type::getType(id);
+                const Enum::Type secondType = Type::getType(second_id);
+                if(type == Enum::Type::NONE || secondType == Enum::Type::NONE) {
+                    return nullptr;
+                }
+
+                return collisionHandlers[std::size_t(type)][std::size_t(secondType)];
+            }
 
-            for(EntityID secondID = 0; secondID < Component::bases.size(); secondID++) 
+            // the collisions of the current tick that have a handler
+            std::vector<CollisionEvent> events;
+
+            struct Contact
+            {
+                EntityID secondID;
+                COLLISION collision;
+            };
+
+            // where the contacts of a body are in the buffer of the thread that detected them
+            struct ContactSpan
             {
-                if(Manager::canAccess(secondID)) 
+                unsigned int thread;
+                std::uint32_t begin;
+                std::uint32_t end;
+            };
+
+            // only reads the world, safe to run on many bodies at the same time
+            // as long as there are no dirty bounds.
+            // the neighbours are tested four at a time against the cached bounds
+            void detect(EntityID id, std::vector<EntityID>& neighbours, std::vector<Contact>& contacts)
+            {
+                const sf::FloatRect& bounds = System::Base::getBounds(id);
+
+                neighbours.clear();
+                Spatial::query(bounds, neighbours);
+                neighbours.erase(std::remove(neighbours.begin(), neighbours.end(), id), neighbours.end());
+
+                AABB::Lanes lanes;
+                COLLISION collisions[AABB::LANES];
+
+                for(std::size_t first = 0; first < neighbours.size(); first += AABB::LANES)
                 {
-                    if(secondID != id) 
+                    const std::size_t count = std::min(AABB::LANES, neighbours.size() - first);
+                    for(std::size_t lane = 0; lane < AABB::LANES; lane++) 
+                    {
+                        // the unused lanes repeat the last one, their results are ignored
+                        const std::size_t index = first + std::min(lane, count - 1);
+                        lanes.set(lane, System::Base::getBounds(neighbours[index]));
+                    }
+
+                    AABB::test4(bounds, lanes, collisions);
+
+                    for(std::size_t lane = 0; lane < count; lane++)
                     {
-                        COLLISION collision = Physics::Helper::checkIntersections(id, secondID);
-                        const bool rigid = Physics::getRigidbody(secondID);
+                        if(collisions[lane] != COLLISION::NONE) {
+                            contacts.push_back(Contact { neighbours[first + lane], collisions[lane] });
+                        }
+                    }
+                }
+            }
 
-                        // std::cout<< "Main ID: " << id << " For ID: " << secondID << "Rigid: " << rigid << std::endl;
+            void resolve(EntityID id, const Contact* begin, const Contact* end) noexcept
+            {
+                bool touchingGround = false;
+                Enum::Direction blockedDirection = Enum::Direction::NONE;
 
-                        if(rigid)
+                for(const Contact* contact = begin; contact != end; contact++) 
+                {
+                    const EntityID secondID   = contact->secondID;
+                    const COLLISION collision = contact->collision;
+
+                    if(Physics::getRigidbody(secondID))
+                    {
+                        if(collision == COLLISION::TOP) 
+                        {
+                            touchingGround = true;
+                            blockedDirection = Enum::Direction::TOP;
+                        } 
+                        else if(collision == COLLISION::BOTTOM) 
                         {
-                            if(collision == COLLISION::TOP) 
-                            {
-                                touchingGround = true;
-                                blockedDirection = Enum::Direction::TOP;
-                            } 
-                            else if(collision == COLLISION::BOTTOM) 
-                            {
-                                Movement::setJumping(id, false);
-                                blockedDirection = Enum::Direction::BOTTOM;
-                            }
-                            else if(collision == COLLISION::RIGHT) {
-                                blockedDirection = Enum::Direction::RIGHT;
-                            }
-                            else if(collision == COLLISION::LEFT) {
-                                blockedDirection = Enum::Direction::LEFT;
-                            } 
+                            Movement::setJumping(id, false);
+                            blockedDirection = Enum::Direction::BOTTOM;
                         }
+                        else if(collision == COLLISION::RIGHT) {
+                            blockedDirection = Enum::Direction::RIGHT;
+                        }
+                        else if(collision == COLLISION::LEFT) {
+                            blockedDirection = Enum::Direction::LEFT;
+                        } 
+                    }
 
-                        Physics::Helper::checkTouchingObject(id, secondID, collision);
+                    // what happens to the entities is handled after every body moved
+                    if(getCollisionHandler(id, secondID) != nullptr) {
+                        events.push_back(CollisionEvent { id, secondID, collision });
                     }
                 }
+
+                if(touchingGround) {
+                    Physics::setOnGround(id, true);
+                } 
+                else {
+                    Physics::setOnGround(id, false);
+                }
+
+                Movement::setBlockedDirection(id, blockedDirection);
+                Physics::Helper::checkFalling(id);
             }
 
-            if(touchingGround) {
-                Physics::setOnGround(id, true);
-            } 
-            else {
-                Physics::setOnGround(id, false);
+            // reused between the ticks to avoid allocating every frame
+            std::vector<EntityID> bodies;
+            std::vector<ContactSpan> spans;
+            std::vector<std::vector<EntityID>> threadNeighbours;
+            std::vector<std::vector<Contact>> threadContacts;
+        } // namespace
+
+        void start(EntityID id) noexcept
+        {
+            PROFILE_SCOPE(Profiler::Section::PHYSICS);
+
+            static std::vector<EntityID> neighbours;
+            static std::vector<Contact> contacts;
+            contacts.clear();
+
+            Base::updateDirtyBounds();
+
+            detect(id, neighbours, contacts);
+            resolve(id, contacts.data(), contacts.data() + contacts.size());
+            handleCollisionEvents();
+        }
+
+        void startAll() noexcept
+        {
+            PROFILE_SCOPE(Profiler::Section::PHYSICS);
+
+            // everything active with physics that isn't a rigidbody (the blocks) is being moved by it
+            bodies.clear();
+            Activation::each(Component::physics, [](EntityID id, const Component::Physics& physics) 
+            {
+                if(not physics.isRigidbody) {
+                    bodies.push_back(id);
+                }
+            });
+
+            // getBounds is not computing anything on the threads after this
+            Base::updateDirtyBounds();
+
+            const unsigned int threads = Jobs::getThreadCount();
+            threadNeighbours.resize(threads);
+            threadContacts.resize(threads);
+            for(auto& contacts : threadContacts) {
+                contacts.clear();
+            }
+
+            spans.resize(bodies.size());
+
+            // first detect every collision in parallel, nothing is changed in here
+            auto detectRange = [](std::size_t begin, std::size_t end, unsigned int thread)
+            {
+                auto& neighbours = threadNeighbours[thread];
+                auto& contacts   = threadContacts[thread];
+
+                for(std::size_t i = begin; i < end; i++)
+                {
+                    const std::uint32_t first = contacts.size();
+                    detect(bodies[i], neighbours, contacts);
+                    spans[i] = ContactSpan { thread, first, std::uint32_t(contacts.size()) };
+                }
+            };
+            Jobs::parallelFor(bodies.size(), PHYSICS_JOB_CHUNK, detectRange);
+
+            // then resolve them one body after another, in the same order every time
+            for(std::size_t i = 0; i < bodies.size(); i++)
+            {
+                const ContactSpan& span = spans[i];
+                const Contact* contacts = threadContacts[span.thread].data();
+
+                resolve(bodies[i], contacts + span.begin, contacts + span.end);
+            }
+
+            handleCollisionEvents();
+        }
+
+        void handleCollisionEvents() noexcept
+        {
+            // the same order no matter in which order the bodies moved
+            std::sort(events.begin(), events.end(), [](const CollisionEvent& lhs, const CollisionEvent& rhs) {
+                return lhs.a != rhs.a ? lhs.a < rhs.a : lhs.b < rhs.b;
+            });
+
+            for(const CollisionEvent& event : events)
+            {
+                getCollisionHandler(event.a, event.b)(event.a, event.b, event.direction);
             }
 
-            Movement::setBlockedDirection(id, blockedDirection);
-            Physics::Helper::checkFalling(id);
+            events.clear();
+        }
+
+        void setCollisionHandler(Enum::Type type, Enum::Type second_type, CollisionHandler handler) noexcept {
+            collisionHandlers[std::size_t(type)][std::size_t(second_type)] = handler;
+        }
+
+        std::size_t getCapacity() noexcept
+        {
+            std::size_t capacity = events.capacity() + bodies.capacity() + spans.capacity() +
+                                   threadNeighbours.capacity() + threadContacts.capacity();
+
+            for(const auto& neighbours : threadNeighbours) capacity += neighbours.capacity();
+            for(const auto& contacts : threadContacts)     capacity += contacts.capacity();
+
+            return capacity;
         }
 
         void setSpeed(EntityID id, float speed) noexcept
@@ -532,10 +1138,8 @@ namespace System
 
         bool getRigidbody(EntityID id) noexcept
         {
-            if(Component::physics.find(id) != Component::physics.end())
-            {
-                const auto& physics = Component::physics[id];
-                return physics.isRigidbody;
+            if(Component::physics.contains(id)) {
+                return Component::physics.at(id).isRigidbody;
             }
 
             return false;
@@ -543,100 +1147,18 @@ namespace System
 
         namespace Helper
         {
-            COLLISION checkIntersections(EntityID id, EntityID second_id) noexcept
-            {
-                const sf::FloatRect idGlobalBounds  = System::Base::getSprite(id).getGlobalBounds();
-                const sf::FloatRect sidGlobalBounds = System::Base::getSprite(second_id).getGlobalBounds();
-            
-                const float idRight   = idGlobalBounds.left  + (idGlobalBounds.width / 2);
-                const float idBottom  = idGlobalBounds.top   + (idGlobalBounds.height / 2);
-                const float sidRight  = sidGlobalBounds.left + (sidGlobalBounds.width / 2);
-                const float sidBottom = sidGlobalBounds.top  + (sidGlobalBounds.height / 2);
-
-
-                if(idGlobalBounds.intersects(sidGlobalBounds)) 
-                {
-                    // Touching on the top
-                    if(sidBottom >= idGlobalBounds.top && idRight >= sidGlobalBounds.left && sidRight >= idGlobalBounds.left) {
-                        return COLLISION::TOP;
-                    }
-
-                    // Touching on the right
-                    if(idRight >= sidGlobalBounds.left && idBottom >= sidGlobalBounds.top && sidBottom >= idGlobalBounds.top) {
-                        return COLLISION::RIGHT;
-                    }
-
-                    // Touching on the left
-                    if(sidRight >= idGlobalBounds.left && idBottom >= sidGlobalBounds.top && sidBottom >= idGlobalBounds.top) {
-                        return COLLISION::LEFT;
-                    }
-
-                    // Touching on the bottom
-                    if(idBottom >= sidGlobalBounds.top && idRight >= sidGlobalBounds.left && sidRight >= idGlobalBounds.left) {
-                        return COLLISION::BOTTOM;
-                    }
-                }
-
-                return COLLISION::NONE;
+            COLLISION checkIntersections(EntityID id, EntityID second_id) noexcept {
+                return AABB::test(System::Base::getBounds(id), System::Base::getBounds(second_id));
             }
 
             void checkFalling(EntityID id) noexcept
             {
-                auto& physics  = Component::physics[id];
-                
                 // Falling when not touching anything or Jumping
                 if(Physics::isMidAir(id) && not Movement::getJumping(id)) {
-                    System::Base::getSprite(id).move(0, Physics::getSpeed(id));
+                    System::Base::move(id, sf::Vector2f(0, Physics::getSpeed(id)));
                 } 
-                else if(Movement::getJumping(id)) 
-                {
-                    System::Base::getSprite(id).move(0, Physics::getSpeed(id) * -1);
-
-                    if(sf::Time timer = physics.jumpClock.getElapsedTime();
-                    timer >= sf::milliseconds(Physics::getMaxJumpHeight(id)))
-                    {
-                        Movement::setJumping(id, false);
-                        physics.jumpClock.restart();
-                    }
-                }
-            }
-
-            void checkTouchingObject(EntityID id, EntityID second_id, COLLISION collision) noexcept
-            {
-                const auto typeID       = Type::getType(id);
-                const auto secondIDType = Type::getType(second_id);
-
-                if(typeID == Enum::Type::MARIO)
-                {
-                    // Entities
-                    if(secondIDType == Enum::Type::COIN) {
-                        Physics::Helper::checkTouchedCoin(id, second_id, collision);
-                    }
-                    else if(secondIDType == Enum::Type::BLOCK) {
-                        Physics::Helper::checkTouchedBlock(id, second_id, collision);
-                    }
-                    else if(secondIDType == Enum::Type::MUSHROOM) {
-                        Physics::Helper::checkTouchedMushroom(id, second_id, collision);
-                    }
-                    else if(secondIDType == Enum::Type::FLOWER) {
-                        Physics::Helper::checkTouchedFlower(id, second_id, collision);
-                    }
-
-                    // Enemies
-                    else if(secondIDType == Enum::Type::GOOMBA) {
-                        Physics::Helper::checkTouchedGoomba(id, second_id, collision);
-                    }
-                    else if(secondIDType == Enum::Type::SPINY) {
-                        Physics::Helper::checkTouchedSpiny(id, second_id, collision);
-                    }
-                }
-                else if(typeID == Enum::Type::FIRE) 
-                {
-                    if(secondIDType == Enum::Type::GOOMBA ||
-                        secondIDType == Enum::Type::SPINY) 
-                    {
-                        Physics::Helper::fireTouchedEnemy(id, second_id, collision);
-                    }
+                else if(Movement::getJumping(id)) {
+                    System::Base::move(id, sf::Vector2f(0, Physics::getSpeed(id) * -1));
                 }
             }
 
@@ -750,23 +1272,26 @@ namespace System
         } // namespace Helper
     } // namespace Physics
 
-    namespace GlobalVariables
+    namespace States
     {
-        sf::Clock& getClock(EntityID id) noexcept
-        {
-            auto& global = Component::globalVariables[id];
+        Component::WalkerState& getWalker(EntityID id) noexcept {
+            return Component::walkerStates.at(id);
+        }
 
-            if(not global.clock.has_value()) {
-                global.clock = std::make_optional<sf::Clock>();
-            }
+        Component::BlockState& getBlock(EntityID id) noexcept {
+            return Component::blockStates.at(id);
+        }
 
-            return global.clock.value();
+        Component::PopOutState& getPopOut(EntityID id) noexcept {
+            return Component::popOutStates.at(id);
         }
 
-        bool existsAny(EntityID id, size_t vector_position) noexcept
-        {
-            auto& global = Component::globalVariables[id];
-            return global.values[vector_position].has_value();
+        Component::FireState& getFire(EntityID id) noexcept {
+            return Component::fireStates.at(id);
         }
-    }
+
+        Component::PlayerState& getPlayer(EntityID id) noexcept {
+            return Component::playerStates.at(id);
+        }
+    } // namespace States
 } // namespace System
\ No newline at end of file
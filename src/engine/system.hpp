@@ -8,39 +8,178 @@
 namespace System 
 {
     // ----------- Render ------------ //
+    // drawAll only takes the entities inside of the current view
+    // (asking the spatial grids for them), and batches every sprite
+    // that shares a texture into one vertex array, so it's one
+    // draw call per texture.
     class Render
     {
     public:
-        constexpr Render(sf::RenderWindow& window) 
-            : m_window(window) {}
+        struct Stats
+        {
+            std::size_t drawn  = 0;
+            std::size_t culled = 0;
+        };
+
+        Render(sf::RenderTarget& target) 
+            : m_target(target) {}
         void draw(EntityID id) noexcept;
-        void drawAll() noexcept;
+
+        // `interpolation` is how far the frame is between the previous
+        // tick (0) and the current one (1)
+        void drawAll(float interpolation = 1.f) noexcept;
+
+        // what happened in the last drawAll
+        const Stats& getStats() const noexcept { return m_stats; }
+
+        // visible list + batches + the most vertices every batch had
+        std::size_t getCapacity() const noexcept;
 
     private:
-        sf::RenderWindow& m_window;
+        struct Batch
+        {
+            const sf::Texture* texture;
+            sf::VertexArray vertices;
+
+            // the vertex array doesn't tell its capacity,
+            // it only grows when it has more vertices than ever
+            std::size_t mostVertices = 0;
+        };
+
+        void addToBatch(const sf::Sprite& sprite, const sf::Vector2f& offset);
+
+        sf::RenderTarget& m_target;
+
+        // kept between frames so they keep their memory
+        std::vector<Batch> m_batches;
+        std::vector<EntityID> m_visible;
+
+        Stats m_stats;
     };
 
     // --------- Game Loop ------------- //
+    // every type has a system that updates all of its entities
+    // in one loop, they run in the order they were added.
     namespace Game
     {
+        using SystemFunction = void(*)();
+
+        void addSystem(Enum::Type type, SystemFunction system) noexcept;
+
         void update(EntityID id) noexcept;
         void updateAll() noexcept;
 
+        // the entity is not removed right away, it's queued and
+        // destroyed at the end of updateAll together with the others
         void removeID(EntityID id, WAIT_FOR_ANIM wait_for_anim) noexcept;
 
-        namespace {
-            inline std::vector<std::pair<EntityID, 
-                /*wait for animation to finish*/bool>> removeableIDS;
-        } // namespace
+        // the removed entities of the type are handed to it instead of being destroyed
+        using RecycleFunction = void(*)(EntityID);
+        void setRecycler(Enum::Type type, RecycleFunction recycle) noexcept;
+
+        void processRemovals() noexcept;
+
+        // how many entities are waiting for their animation to finish
+        std::size_t getPendingRemovals() noexcept;
+
+        // remove queue + pending removals + systems
+        std::size_t getCapacity() noexcept;
     } // namespace Game
 
+    // --------- Activation ----------------- //
+    // only the entities around the camera are simulated, the ones outside
+    // of the region are parked (no physics, animation or updates) until
+    // they are inside of it again. without a region everything is simulated.
+    namespace Activation
+    {
+        // the view of the camera, grown by `margin` on every side
+        void setRegion(const sf::FloatRect& view, float margin = ACTIVATION_MARGIN) noexcept;
+        void clearRegion() noexcept;
+        bool isLimited() noexcept;
+
+        // simulated wherever it is, like the player the camera follows.
+        // it's dropped once it's removed
+        void keepActive(EntityID id);
+
+        // finds the entities inside of the region, called by Game::updateAll
+        void update();
+
+        // the entities that were created since the last update are active too
+        bool isActive(EntityID id) noexcept;
+        const ComponentMemberSet& getEntities(Enum::Type type) noexcept;
+
+        // only when the region is limited
+        const ComponentMemberSet& getEntities() noexcept;
+
+        // active sets + found + kept
+        std::size_t getCapacity() noexcept;
+
+        // function(id, component) for the active entities of the pool, it's walked
+        // by index so the function can create entities. an archetype column is walked
+        // chunk by chunk instead, so the function can't add or erase its components
+        template<typename PoolType, typename Function>
+        void each(PoolType& pool, Function&& function)
+        {
+            if(not isLimited())
+            {
+                if constexpr(is_archetype_column_v<PoolType>) 
+                {
+                    pool.each(function);
+                    return;
+                }
+
+                for(std::size_t index = 0; index < pool.size(); index++) {
+                    function(pool.entityAt(index), pool.componentAt(index));
+                }
+
+                return;
+            }
+
+            const ComponentMemberSet& active = getEntities();
+            for(std::size_t index = 0; index < active.size(); index++)
+            {
+                const EntityID id = active.entityAt(index);
+                if(pool.contains(id)) {
+                    function(id, pool.at(id));
+                }
+            }
+        }
+
+        namespace Helper
+        {
+            // called when the type of an entity is set
+            void wake(EntityID id, Enum::Type previous, Enum::Type type);
+        } // namespace Helper
+    } // namespace Activation
+
     // --------- Base ----------------- //
     namespace Base
     {
         void setState(EntityID id, Enum::State state) noexcept;
 
+        // changing the sprite marks its bounds as dirty, they are computed
+        // again (and the spatial grid updated) when they are needed next time
+        void setPosition(EntityID id, const sf::Vector2f& position) noexcept;
+        void move(EntityID id, const sf::Vector2f& offset) noexcept;
+        void setTextureRect(EntityID id, const sf::IntRect& rect) noexcept;
+
+        // computes the bounds of every dirty entity
+        void updateDirtyBounds() noexcept;
+
+        // the entity is never going to move, moves it to the static collision layer
+        void setStatic(EntityID id) noexcept;
+
+        // needs to be called at the beginning of every tick
+        void savePreviousPositions() noexcept;
+
+        // marks the bounds as dirty, prefer getPosition / getBounds for reading
         sf::Sprite& getSprite(EntityID id) noexcept;
+        const sf::Vector2f& getPosition(EntityID id) noexcept;
+        const sf::FloatRect& getBounds(EntityID id) noexcept;
         Enum::State& getState(EntityID id);
+
+        // of the dirty bounds list
+        std::size_t getCapacity() noexcept;
     }
 
     // --------- Type ----------------- //
@@ -51,6 +190,7 @@ namespace System
         void setWhatType(EntityID id, Enum::Mature maturity) noexcept;
 
         Enum::Type getType(EntityID id) noexcept;
+        const ComponentMemberSet& getEntities(Enum::Type type) noexcept;
         const BlockPair& getBlockPair(EntityID id) noexcept;
         Enum::Mature getMaturity(EntityID id) noexcept;
     }
@@ -58,21 +198,19 @@ namespace System
     // ----------- Animation ------------ //
     namespace Animation 
     {
-        // this function is needed to be called in the update loop
-        void play(EntityID id) noexcept;
+        // advances all of the animations by one tick, called by Game::updateAll
+        void playAll() noexcept;
 
-        void addFrame(EntityID id, int pos, const sf::IntRect& anim) noexcept;
+        // the clips of the entity, see Clips
+        void setClips(EntityID id, Clips::SetID clips) noexcept;
         void setCurrentAnimation(EntityID id, int pos) noexcept;
-        void setNextAnimationTimer(EntityID id, unsigned int next_animation_timer) noexcept;
-        void setFrames(EntityID id, int pos, const AnimationVector& anims) noexcept;
-        void setFrames(EntityID id, int pos, const sf::IntRect& anim) noexcept;
+        void setNextAnimationTimer(EntityID id, unsigned int next_animation_timer) noexcept; // in ms
         void setStopWhenFinished(EntityID id, bool stop) noexcept;
         void setAllowPlay(EntityID id, bool allow) noexcept;
         void setStarted(EntityID id, bool started) noexcept;
         void setFinished(EntityID id, bool finished) noexcept;
 
         bool getAnimationFinished(EntityID id) noexcept;
-        const AnimationVector& getFrames(EntityID id, int pos);
         int getCurrentAnimation(EntityID id) noexcept;
         bool getStarted(EntityID id) noexcept;
         bool getFinished(EntityID id) noexcept;
@@ -81,6 +219,9 @@ namespace System
         {
             // Helping extract the correct texture rect
             sf::IntRect extractTextureRect(const sf::IntRect& rect) noexcept;
+
+            // one tick of an animation, true if another frame has to be shown
+            bool advance(Component::Animation& animation) noexcept;
         } // namespace Helper
     } // namespace Animation
 
@@ -104,12 +245,43 @@ namespace System
         bool getJumping(EntityID id) noexcept;
         bool getRunning(EntityID id) noexcept;
         bool getMoving(EntityID id) noexcept;
+
+        namespace Helper
+        {
+            // the jump ends after `height` ms
+            void startJumpTimer(EntityID id, unsigned int height);
+        } // namespace Helper
     } // namespace Movement
 
     // ----------- Physics ------------ //
     namespace Physics
     {
+        // two entities touched each other, `a` is the one that moved
+        struct CollisionEvent
+        {
+            EntityID a;
+            EntityID b;
+            COLLISION direction;
+        };
+
+        using CollisionHandler = bool(*)(EntityID id, EntityID second_id, COLLISION collision);
+
+        // moves a single entity
         void start(EntityID id) noexcept;
+
+        // moves every entity that has physics and isn't a rigidbody.
+        // it's done in two steps, detecting all of the collisions on
+        // all of the threads and then resolving them one by one.
+        // called by Game::updateAll before the systems.
+        void startAll() noexcept;
+
+        // the collisions are not handled while the bodies are moving,
+        // they are collected and then handled by the type of the two entities
+        void handleCollisionEvents() noexcept;
+        void setCollisionHandler(Enum::Type type, Enum::Type second_type, CollisionHandler handler) noexcept;
+
+        // bodies + spans + every thread's neighbours and contacts + events
+        std::size_t getCapacity() noexcept;
         
         void setOnGround(EntityID id, bool on_ground) noexcept;
         void setSpeed(EntityID id, float speed) noexcept;
@@ -126,7 +298,6 @@ namespace System
             COLLISION checkIntersections(EntityID id, EntityID second_id) noexcept;
 
             void checkFalling(EntityID id) noexcept;
-            void checkTouchingObject(EntityID id, EntityID second_id, COLLISION collision) noexcept;
             bool checkTouchedCoin(EntityID id, EntityID second_id, COLLISION collision) noexcept;
             bool checkTouchedBlock(EntityID id, EntityID second_id, COLLISION collision) noexcept;
             bool checkTouchedGoomba(EntityID id, EntityID second_id, COLLISION collision) noexcept;
@@ -137,63 +308,16 @@ namespace System
         } // namespace Helper
     } // namespace Physics
 
-    // ----------- GlobalVariables ------------ //
-    namespace GlobalVariables
+    // ----------- States ------------ //
+    // the entity must have the state component
+    namespace States
     {
-        template<typename T>
-        constexpr std::enable_if_t<std::is_arithmetic_v<T>> addAny(EntityID id, T value) noexcept 
-        {
-            auto& global = Component::globalVariables[id];
-            global.values.push_back(value);
-        }
-
-        inline void addAny(EntityID id) noexcept 
-        {
-            auto& global = Component::globalVariables[id];
-            global.values.push_back({});
-        }
-
-        template<typename T>
-        constexpr std::enable_if_t<std::is_arithmetic_v<T>> setAny(EntityID id, T value, size_t vector_position) noexcept 
-        {
-            auto& global = Component::globalVariables[id];
-            global.values[vector_position] = value;
-        }
-
-        template<typename T>
-        constexpr std::enable_if_t<std::is_arithmetic_v<T>> setLastAny(EntityID id, T value) noexcept 
-        {
-            auto& global = Component::globalVariables[id];
-            global.values[global.values.size() - 1] = value;
-        }
-
-        template<typename T>
-        constexpr std::enable_if_t<std::is_arithmetic_v<T>> setAnyOnce(EntityID id, T value, size_t vector_position) noexcept 
-        {
-            auto& global = Component::globalVariables[id];
-            if(not global.values[vector_position].has_value()) {
-                global.values[vector_position] = value;
-            }
-        }
-
-        sf::Clock& getClock(EntityID id) noexcept;
-        
-        template<typename T, typename = std::enable_if<std::is_arithmetic_v<T>>>
-        constexpr T getLastAny(EntityID id) noexcept 
-        {
-            auto& global = Component::globalVariables[id];
-            return std::any_cast<T>(global.values[global.values.size() - 1]);
-        }
-
-        template<typename T, typename = std::enable_if<std::is_arithmetic_v<T>>>
-        constexpr T getAny(EntityID id, size_t vector_position) noexcept
-        {
-            auto& global = Component::globalVariables[id];
-            return std::any_cast<T>(global.values[vector_position]);
-        }
-
-        bool existsAny(EntityID id, size_t vector_position) noexcept;
-    } // namespace GlobalVariables
+        Component::WalkerState& getWalker(EntityID id) noexcept;
+        Component::BlockState& getBlock(EntityID id) noexcept;
+        Component::PopOutState& getPopOut(EntityID id) noexcept;
+        Component::FireState& getFire(EntityID id) noexcept;
+        Component::PlayerState& getPlayer(EntityID id) noexcept;
+    } // namespace States
 
 } // namespace System
 
@@ -0,0 +1,87 @@
+#include "textures.hpp"
+
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <exception>
+#include <iostream>
+
+namespace Textures
+{
+    namespace 
+    {
+        // the textures are on the heap so the sprites' pointers to them
+        // stay valid when the vector grows
+        std::vector<std::unique_ptr<sf::Texture>>  textures;
+        std::vector<sf::Vector2u>                  sizes;
+        std::unordered_map<std::string, TextureID> handles;
+
+        bool headlessMode = false;
+    } // namespace
+
+    TextureID load(const std::string& png)
+    {
+        if(auto handle = handles.find(png); handle != handles.end()) {
+            return handle->second;
+        }
+
+        // sf::Texture opens a display to get an OpenGL context,
+        // so when headless there is no sf::Texture made at all
+        std::unique_ptr<sf::Texture> texture;
+        sf::Vector2u size;
+
+        if(headlessMode) 
+        {
+            sf::Image image;
+            if(not image.loadFromFile(png)) {
+                throw std::runtime_error(std::string("Failed to load " + png));
+            }
+
+            size = image.getSize();
+        }
+        else 
+        {
+            texture = std::make_unique<sf::Texture>();
+            if(not texture->loadFromFile(png)) {
+                throw std::runtime_error(std::string("Failed to load " + png));
+            }
+
+            size = texture->getSize();
+        }
+
+        #ifdef ENABLE_DEBUG_MODE
+        std::cout << "Texture: " << textures.size() << " Loaded! - " << png << std::endl;
+        #endif
+
+        textures.push_back(std::move(texture));
+        sizes.push_back(size);
+        return handles[png] = textures.size() - 1;
+    }
+
+    TextureID insert(const std::string& name, const sf::Texture& texture)
+    {
+        if(auto handle = handles.find(name); handle != handles.end()) {
+            return handle->second;
+        }
+
+        textures.push_back(std::make_unique<sf::Texture>(texture));
+        sizes.push_back(texture.getSize());
+        return handles[name] = textures.size() - 1;
+    }
+
+    const sf::Texture& get(TextureID id) noexcept {
+        return *textures[id];
+    }
+
+    sf::Vector2u getSize(TextureID id) noexcept {
+        return sizes[id];
+    }
+
+    void setHeadless(bool headless) noexcept {
+        headlessMode = headless;
+    }
+
+    bool isHeadless() noexcept {
+        return headlessMode;
+    }
+} // namespace Textures
@@ -0,0 +1,33 @@
+#ifndef TEXTURES_HPP
+#define TEXTURES_HPP
+
+#include <SFML/Graphics.hpp>
+
+#include <string>
+#include <cstddef>
+
+// ---------------------------------------------------------- //
+// Texture cache
+// every image is decoded and uploaded to the GPU only once,
+// entities are referring to it by a handle.
+// ---------------------------------------------------------- //
+namespace Textures
+{
+    using TextureID = std::size_t;
+
+    // loads `png` the first time, afterwards returns the same handle
+    TextureID load(const std::string& png);
+
+    // stores a texture that was made in code (e.g. a recolored one) under `name`
+    TextureID insert(const std::string& name, const sf::Texture& texture);
+
+    const sf::Texture& get(TextureID id) noexcept;
+    sf::Vector2u getSize(TextureID id) noexcept;
+
+    // without a window nothing is uploaded to the GPU, the images
+    // are only decoded for their sizes and `get` can't be used
+    void setHeadless(bool headless) noexcept;
+    bool isHeadless() noexcept;
+} // namespace Textures
+
+#endif
@@ -0,0 +1,204 @@
+#include "timers.hpp"
+#include "manager.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace Timers
+{
+    namespace
+    {
+        constexpr unsigned int SLOT_BITS = 6;
+        constexpr std::size_t  SLOTS     = std::size_t(1) << SLOT_BITS;
+        constexpr std::size_t  LEVELS    = 4; // 2^24 ticks, a few days
+
+        constexpr std::uint32_t NONE = std::numeric_limits<std::uint32_t>::max();
+
+        struct Timer
+        {
+            std::uint64_t expires;
+            EntityID entity;
+            Callback callback;
+
+            // the handle has it too, starts at 1 so a handle is never NO_TIMER
+            std::uint32_t generation = 1;
+
+            // the list of the slot it's in, NONE when it's free
+            std::uint32_t slot     = NONE;
+            std::uint32_t previous = NONE;
+            std::uint32_t next     = NONE;
+        };
+
+        std::vector<Timer> timers;
+        std::vector<std::uint32_t> freeTimers;
+
+        // level * SLOTS + slot -> first timer
+        std::array<std::uint32_t, LEVELS * SLOTS> heads = [] {
+            std::array<std::uint32_t, LEVELS * SLOTS> empty;
+            empty.fill(NONE);
+            return empty;
+        }();
+
+        std::uint64_t currentTick = 0;
+
+        std::uint32_t slotOf(std::uint64_t expires) noexcept
+        {
+            expires = std::max(expires, currentTick);
+            const std::uint64_t delta = expires - currentTick;
+
+            for(std::size_t level = 0; level < LEVELS; level++)
+            {
+                const unsigned int shift = SLOT_BITS * level;
+                if(delta < (std::uint64_t(1) << (shift + SLOT_BITS))) {
+                    return level * SLOTS + ((expires >> shift) & (SLOTS - 1));
+                }
+            }
+
+            // too far away, waits as far as the last level goes and gets spread again
+            const unsigned int shift = SLOT_BITS * (LEVELS - 1);
+            const std::uint64_t furthest = currentTick + (std::uint64_t(1) << (SLOT_BITS * LEVELS)) - 1;
+            return (LEVELS - 1) * SLOTS + ((furthest >> shift) & (SLOTS - 1));
+        }
+
+        void link(std::uint32_t index) noexcept
+        {
+            Timer& timer = timers[index];
+            timer.slot     = slotOf(timer.expires);
+            timer.previous = NONE;
+            timer.next     = heads[timer.slot];
+
+            if(timer.next != NONE) {
+                timers[timer.next].previous = index;
+            }
+
+            heads[timer.slot] = index;
+        }
+
+        void unlink(std::uint32_t index) noexcept
+        {
+            Timer& timer = timers[index];
+
+            if(timer.previous != NONE) {
+                timers[timer.previous].next = timer.next;
+            }
+            else {
+                heads[timer.slot] = timer.next;
+            }
+
+            if(timer.next != NONE) {
+                timers[timer.next].previous = timer.previous;
+            }
+
+            timer.slot = NONE;
+        }
+
+        // the handles of it don't match anymore
+        void release(std::uint32_t index) noexcept
+        {
+            Timer& timer = timers[index];
+            if(++timer.generation == 0) {
+                timer.generation = 1;
+            }
+
+            freeTimers.push_back(index);
+        }
+
+        // moves the timers of a slot of an upper level to the levels below it
+        void spread(std::uint32_t slot) noexcept
+        {
+            std::uint32_t index = heads[slot];
+            heads[slot] = NONE;
+
+            while(index != NONE)
+            {
+                const std::uint32_t next = timers[index].next;
+                link(index);
+                index = next;
+            }
+        }
+    } // namespace
+
+    TimerID schedule(EntityID id, unsigned int ticks, Callback callback)
+    {
+        std::uint32_t index;
+        if(not freeTimers.empty())
+        {
+            index = freeTimers.back();
+            freeTimers.pop_back();
+        }
+        else
+        {
+            index = timers.size();
+            timers.emplace_back();
+
+            // so releasing never allocates
+            freeTimers.reserve(timers.capacity());
+        }
+
+        Timer& timer = timers[index];
+        timer.expires  = currentTick + std::max(ticks, 1u);
+        timer.entity   = id;
+        timer.callback = callback;
+        link(index);
+
+        return (TimerID(timer.generation) << 32) | index;
+    }
+
+    void cancel(TimerID handle) noexcept
+    {
+        const std::uint32_t index = static_cast<std::uint32_t>(handle);
+        if(handle == NO_TIMER || index >= timers.size()) {
+            return;
+        }
+
+        const Timer& timer = timers[index];
+        if(timer.generation != static_cast<std::uint32_t>(handle >> 32) || timer.slot == NONE) {
+            return;
+        }
+
+        unlink(index);
+        release(index);
+    }
+
+    void advance() noexcept
+    {
+        currentTick++;
+
+        // a level wrapped around, the next slot of the one above is due
+        for(std::size_t level = 1; level < LEVELS; level++)
+        {
+            const unsigned int shift = SLOT_BITS * level;
+            if(currentTick & ((std::uint64_t(1) << shift) - 1)) {
+                break;
+            }
+
+            spread(level * SLOTS + ((currentTick >> shift) & (SLOTS - 1)));
+        }
+
+        // the callbacks can schedule and cancel, so it's taken one by one
+        const std::uint32_t slot = currentTick & (SLOTS - 1);
+        while(heads[slot] != NONE)
+        {
+            const std::uint32_t index = heads[slot];
+            const EntityID entity     = timers[index].entity;
+            const Callback callback   = timers[index].callback;
+
+            unlink(index);
+            release(index);
+
+            if(Manager::canAccess(entity)) {
+                callback(entity);
+            }
+        }
+    }
+
+    std::uint64_t now() noexcept {
+        return currentTick;
+    }
+
+    std::size_t getCapacity() noexcept {
+        return timers.capacity();
+    }
+} // namespace Timers
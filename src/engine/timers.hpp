@@ -0,0 +1,44 @@
+#ifndef TIMERS_HPP
+#define TIMERS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "components.hpp"
+
+// ---------------------------------------------------------- //
+// Hierarchical timer wheel
+// a timer calls a function with its entity after a number of ticks.
+// every level of the wheel has 64 slots, a slot of the first level
+// is one tick and a slot of every next level is a whole turn of the
+// one below it. when a lower level wraps around, the next slot of the
+// level above is spread into it.
+//
+// scheduling, cancelling and running out are O(1), and only the
+// slot of the current tick is touched every tick. the timers of
+// an entity that was removed are dropped when they run out.
+// ---------------------------------------------------------- //
+namespace Timers
+{
+    // a plain function pointer, a lambda without captures works too
+    using Callback = void(*)(EntityID);
+
+    constexpr TimerID NO_TIMER = 0;
+
+    // runs on the advance that is `ticks` from now (at least the next one)
+    TimerID schedule(EntityID id, unsigned int ticks, Callback callback);
+
+    // does nothing if it already ran out or was cancelled
+    void cancel(TimerID timer) noexcept;
+
+    // moves the wheel one tick forward and runs the timers that ran out
+    void advance() noexcept;
+
+    // the tick the wheel is at
+    std::uint64_t now() noexcept;
+
+    // timers, the free ones included
+    std::size_t getCapacity() noexcept;
+} // namespace Timers
+
+#endif
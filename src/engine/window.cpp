@@ -1,36 +1,51 @@
 #include "window.hpp"
 #include "manager.hpp"
 #include "system.hpp"
+#include "input.hpp"
 #include "helpers/values.hpp"
 
-Window::Window() 
-	: window(sf::VideoMode(WIDTH, HEIGHT), TITLE.data()), view(window.getDefaultView())
+Window::Window(HEADLESS headless) 
+	: view(sf::FloatRect(0, 0, WIDTH, HEIGHT)), previousCenter(view.getCenter())
 {
-	window.setFramerateLimit(DEFAULT_FPS);
+	if(not bool(headless)) 
+	{
+		window.emplace(sf::VideoMode(WIDTH, HEIGHT), TITLE.data());
+
+		// the simulation runs at a fixed rate, rendering follows the display
+		window->setVerticalSyncEnabled(true);
+	}
 }
 
 void Window::eventHandler() noexcept 
 {
+	if(not window) {
+		return;
+	}
+
 	sf::Event event;
-	while (window.pollEvent(event))
+	while (window->pollEvent(event))
 	{
-		if (event.type == sf::Event::Closed || sf::Keyboard::isKeyPressed(sf::Keyboard::Escape))
-			window.close();
+		if (event.type == sf::Event::Closed || Input::isKeyPressed(sf::Keyboard::Escape))
+			window->close();
 	}
 }
 
 void Window::clear() noexcept {
-	window.clear(sf::Color::Cyan);
+	if(window) {
+		window->clear(sf::Color::Cyan);
+	}
 }
 
 void Window::display() noexcept {
-	window.display();
+	if(window) {
+		window->display();
+	}
 }
 
 void Window::updateCamera(EntityID player_id) noexcept
 {
 	if(Manager::canAccess(player_id)) {
-		const sf::Vector2f& objectPosition = System::Base::getSprite(player_id).getPosition();
+		const sf::Vector2f& objectPosition = System::Base::getPosition(player_id);
 		const bool playerRunning		   = System::Movement::getRunning(player_id);
 
 		if(System::Movement::getMoving(player_id)) 
@@ -54,7 +69,19 @@ void Window::updateCamera(EntityID player_id) noexcept
 				}
 			}
 		}
+	}
+}
+
+void Window::saveCamera() noexcept {
+	previousCenter = view.getCenter();
+}
 
-		window.setView(view);
+void Window::interpolateCamera(float interpolation) noexcept 
+{
+	if(window)
+	{
+		sf::View interpolated = view;
+		interpolated.setCenter(previousCenter + (view.getCenter() - previousCenter) * interpolation);
+		window->setView(interpolated);
 	}
 }
\ No newline at end of file
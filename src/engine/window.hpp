@@ -3,25 +3,34 @@
 
 #include <SFML/Graphics.hpp>
 #include <string_view>
+#include <optional>
 
 #include "components.hpp"
+#include "helpers/enums.hpp"
 
+// when headless there is no sf::RenderWindow at all,
+// only the view (camera) is being kept up to date
 class Window {
 public:
-	Window();
+	explicit Window(HEADLESS headless);
 	void eventHandler() noexcept;
 	void clear() noexcept;
 	void display() noexcept;
 	void updateCamera(EntityID player_id) noexcept;
 
+	// the camera moves in ticks like everything else,
+	// these smooth it out between two ticks
+	void saveCamera() noexcept;
+	void interpolateCamera(float interpolation) noexcept;
+
 protected:
 	static constexpr unsigned int WIDTH = 800;
 	static constexpr unsigned int HEIGHT = 600;
-	sf::RenderWindow window;
+	std::optional<sf::RenderWindow> window;
 	sf::View view;
+	sf::Vector2f previousCenter;
 
 private:
-	static constexpr unsigned int DEFAULT_FPS = 45;
 	static constexpr std::string_view TITLE = "Super Mario";
 };
 
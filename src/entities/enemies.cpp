@@ -5,6 +5,7 @@
 #include "../engine/helpers/functions.hpp"
 #include "../engine/helpers/values.hpp"
 #include "../engine/components.hpp"
+#include "../engine/timers.hpp"
 
 namespace Enemy
 {
@@ -13,38 +14,79 @@ namespace Enemy
     // ---------------------------------------------------------- //
     namespace Fire
     {
-        void create(const sf::Vector2f& position, EntityID player_id, Enum::Direction start_direction) noexcept
+        namespace
+        {
+            // the projectiles that are not flying, they have no type and are not in the world
+            std::vector<EntityID> freeFires;
+        } // namespace
+
+        void createPool() noexcept
+        {
+            freeFires.reserve(FIRE_POOL_SIZE);
+
+            // all of them at once, so the pools grow to fit them all flying
+            for(std::size_t i = 0; i < FIRE_POOL_SIZE; i++)
+            {
+                EntityID currentID = Manager::create("assets/fire.png");
+
+                Manager::addComponent<Component::Movement>(currentID);
+                Manager::addComponent<Component::Physics>(currentID);
+                Manager::addComponent<Component::FireState>(currentID);
+
+                freeFires.push_back(currentID);
+            }
+
+            for(EntityID& id : freeFires) {
+                id = Manager::recycle(id);
+            }
+        }
+
+        bool create(sf::Vector2f position, Enum::Direction start_direction) noexcept
         {
             myAssert(start_direction == Enum::Direction::RIGHT &&
                      start_direction == Enum::Direction::LEFT, 
                      "Start Direction of Fire is wrong!");
 
-            EntityID currentID = Manager::create("assets/fire.png");
+            // all of them are flying
+            if(freeFires.empty()) {
+                return false;
+            }
+
+            EntityID currentID = freeFires.back();
+            freeFires.pop_back();
 
             Enemy::Helper::setupBaseType(currentID, position, Enum::Type::FIRE);
 
             Manager::addComponent<Component::Movement>(currentID);
             Manager::addComponent<Component::Physics>(currentID);
-            Manager::addComponent<Component::UpdateFunction>(currentID);
-            Manager::addComponent<Component::GlobalVariables>(currentID);
+            Manager::addComponent<Component::FireState>(currentID);
+
+            System::States::getFire(currentID).moveRight = start_direction == Enum::Direction::RIGHT;
+
+            // timer to kill
+            Timers::schedule(currentID, millisecondsToTicks(FIRE_KILL_TIMER), [](EntityID id) {
+                System::Game::removeID(id, WAIT_FOR_ANIM::FALSE);
+            });
 
-            bool convert_direction = start_direction == Enum::Direction::RIGHT ? true : false;
-            System::GlobalVariables::addAny(currentID, convert_direction); // index 0 - Direction
+            return true;
+        }
 
-            Component::updates[currentID] = [](EntityID update_id) -> void
+        void updateAll() noexcept
+        {
+            const auto& fires = System::Activation::getEntities(Enum::Type::FIRE);
+            for(std::size_t i = 0; i < fires.size(); i++)
             {
-                System::Physics::start(update_id);
-                Fire::Helper::checkMovement(update_id);
-                Fire::Helper::checkDeath(update_id);
-            };
+                const EntityID id = fires.entityAt(i);
+                Fire::Helper::checkMovement(id);
+                Fire::Helper::checkDeath(id);
+            }
         }
 
         namespace Helper
         {
             void checkMovement(EntityID id) noexcept
             {
-                const auto rightLookingDirection = System::GlobalVariables::getLastAny<bool>(id);
-                if(rightLookingDirection) {
+                if(System::States::getFire(id).moveRight) {
                     System::Movement::moveRight(id, FIRE_SPEED);
                 } 
                 else {
@@ -57,22 +99,18 @@ namespace Enemy
                 }
             }
 
+            void recycle(EntityID id) noexcept {
+                freeFires.push_back(Manager::recycle(id));
+            }
+
             void checkDeath(EntityID id) noexcept
             {
                 // if touching anything else than the ground, kill it
-                const auto& clock = System::GlobalVariables::getClock(id);
                 if(System::Movement::getBlockedDirection(id) == Enum::Direction::LEFT   ||
                    System::Movement::getBlockedDirection(id) == Enum::Direction::RIGHT  ||
                    System::Movement::getBlockedDirection(id) == Enum::Direction::BOTTOM)
                 {
                     System::Game::removeID(id, WAIT_FOR_ANIM::FALSE);
-                } 
-
-                // timer to kill
-                else if(sf::Time timer = clock.getElapsedTime();
-                        timer >= sf::milliseconds(FIRE_KILL_TIMER))
-                {
-                    System::Game::removeID(id, WAIT_FOR_ANIM::FALSE);
                 }
             }
         } // namespace Helper
@@ -80,35 +118,45 @@ namespace Enemy
 
     namespace Goomba
     {
-        void create(const sf::Vector2f& position) noexcept
+        void create(sf::Vector2f position) noexcept
         {   
             EntityID currentID = Manager::create("assets/goomba.png");
 
+            Enemy::Helper::setupComponents(currentID);
             Goomba::Helper::setupAnimation(currentID);
             Enemy::Helper::setupBaseType(currentID, position, Enum::Type::GOOMBA);
-            System::GlobalVariables::addAny(currentID, true); // index 0 - moveLeft
+        }
 
-            Component::updates[currentID] = [](EntityID update_id) -> void
+        void updateAll() noexcept
+        {
+            const auto& goombas = System::Activation::getEntities(Enum::Type::GOOMBA);
+            for(std::size_t i = 0; i < goombas.size(); i++)
             {
-                System::Physics::start(update_id);
-                System::Animation::play(update_id);
-
-                Enemy::Helper::standardMovement(update_id);
-            };
+                const EntityID id = goombas.entityAt(i);
+                Enemy::Helper::standardMovement(id);
+            }
         }
 
         namespace Helper
         {
             void setupAnimation(EntityID id) noexcept
             {
-                System::Animation::setFrames(id, int(Enum::Animation::WALK), {
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(0, 0, 16, 16)),
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(16, 0, 32, 16))
-                });
+                static const Clips::SetID clips = [] 
+                {
+                    const Clips::SetID set = Clips::createSet();
+
+                    Clips::setClip(set, int(Enum::Animation::WALK), {
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(0, 0, 16, 16)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(16, 0, 32, 16))
+                    });
+
+                    Clips::setClip(set, int(Enum::Animation::DEAD), 
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(32, 8, 48, 16)));
 
-                System::Animation::setFrames(id, int(Enum::Animation::DEAD), 
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(32, 8, 48, 16)));
+                    return set;
+                }();
 
+                System::Animation::setClips(id, clips);
                 System::Animation::setCurrentAnimation(id, int(Enum::Animation::WALK));
             }
         } // namespace Helper
@@ -116,40 +164,51 @@ namespace Enemy
 
     namespace Spiny
     {
-        void create(const sf::Vector2f& position) noexcept
+        void create(sf::Vector2f position) noexcept
         {
             EntityID currentID = Manager::create("assets/spiny.png");
 
+            Enemy::Helper::setupComponents(currentID);
             Spiny::Helper::setupAnimation(currentID);
             Enemy::Helper::setupBaseType(currentID, position, Enum::Type::SPINY);
-            System::GlobalVariables::addAny(currentID, true); // index 0 - moveLeft
+        }
 
-            Component::updates[currentID] = [](EntityID update_id) -> void
+        void updateAll() noexcept
+        {
+            const auto& spinies = System::Activation::getEntities(Enum::Type::SPINY);
+            for(std::size_t i = 0; i < spinies.size(); i++)
             {
-                System::Physics::start(update_id);
-                System::Animation::play(update_id);
-
-                Enemy::Helper::standardMovement(update_id);
-                Spiny::Helper::checkCorrectAnimation(update_id);
-            };
+                const EntityID id = spinies.entityAt(i);
+                Enemy::Helper::standardMovement(id);
+                Spiny::Helper::checkCorrectAnimation(id);
+            }
         }
 
         namespace Helper
         {
             void setupAnimation(EntityID id) noexcept
             {
-                System::Animation::setFrames(id, int(Enum::Animation::WALK_RIGHT), {
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(47, 0, 63, 16)),
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(63, 0, 79, 16))
-                });
-
-                System::Animation::setFrames(id, int(Enum::Animation::WALK_LEFT), {
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(31, 0, 47, 16)),
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(15, 0, 31, 16))
-                });
-
-                System::Animation::setFrames(id, int(Enum::Animation::DEAD), 
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(0, 0, 14, 16)));
+                static const Clips::SetID clips = [] 
+                {
+                    const Clips::SetID set = Clips::createSet();
+
+                    Clips::setClip(set, int(Enum::Animation::WALK_RIGHT), {
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(47, 0, 63, 16)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(63, 0, 79, 16))
+                    });
+
+                    Clips::setClip(set, int(Enum::Animation::WALK_LEFT), {
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(31, 0, 47, 16)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(15, 0, 31, 16))
+                    });
+
+                    Clips::setClip(set, int(Enum::Animation::DEAD), 
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(0, 0, 14, 16)));
+
+                    return set;
+                }();
+
+                System::Animation::setClips(id, clips);
             }
 
             void checkCorrectAnimation(EntityID id) noexcept
@@ -157,8 +216,7 @@ namespace Enemy
                 const Enum::State state = System::Base::getState(id);
                 if(state == Enum::State::ALIVE)
                 {
-                    const bool moveLeft = System::GlobalVariables::getLastAny<bool>(id);
-                    if(moveLeft) {
+                    if(System::States::getWalker(id).moveLeft) {
                         System::Animation::setCurrentAnimation(id, int(Enum::Animation::WALK_LEFT));
                     } 
                     else  {
@@ -173,7 +231,7 @@ namespace Enemy
     {
         void setupBaseType(EntityID id, const sf::Vector2f& position, Enum::Type enemy_type) noexcept
         {
-            System::Base::getSprite(id).setPosition(position);
+            System::Base::setPosition(id, position);
             System::Base::setState(id, Enum::State::ALIVE);
             System::Type::setType(id, enemy_type);
         }
@@ -183,8 +241,7 @@ namespace Enemy
             Manager::addComponent<Component::Animation>(id);
             Manager::addComponent<Component::Movement>(id);
             Manager::addComponent<Component::Physics>(id);
-            Manager::addComponent<Component::UpdateFunction>(id);
-            Manager::addComponent<Component::GlobalVariables>(id);
+            Manager::addComponent<Component::WalkerState>(id);
         }
 
         // this is just a simple movement
@@ -197,13 +254,14 @@ namespace Enemy
             if(state == Enum::State::ALIVE)
             {
                 const auto blockedDirection = System::Movement::getBlockedDirection(id);
-                const bool moveLeft         = System::GlobalVariables::getLastAny<bool>(id);
+                auto& walker                = System::States::getWalker(id);
+                const bool moveLeft         = walker.moveLeft;
 
                 if(blockedDirection == Enum::Direction::RIGHT) {
-                    System::GlobalVariables::setLastAny(id, false);
+                    walker.moveLeft = false;
                 } 
                 else if(blockedDirection == Enum::Direction::LEFT) {
-                    System::GlobalVariables::setLastAny(id, true);
+                    walker.moveLeft = true;
                 }
 
                 if(moveLeft) {
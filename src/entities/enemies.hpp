@@ -9,18 +9,26 @@ namespace Enemy
 {
     namespace Fire
     {
-        void create(const sf::Vector2f& position, EntityID player_id, Enum::Direction start_direction) noexcept;
+        // the projectiles are made once when the level starts and reused after that,
+        // create takes one of them and returns false when all of them are flying
+        void createPool() noexcept;
+        bool create(sf::Vector2f position, Enum::Direction start_direction) noexcept;
+        void updateAll() noexcept;
 
         namespace Helper
         {
             void checkMovement(EntityID id) noexcept;
             void checkDeath(EntityID id) noexcept;
+
+            // takes it back after it was removed, see System::Game::setRecycler
+            void recycle(EntityID id) noexcept;
         } // namespace Helper
     } // namespace Fire
 
     namespace Goomba
     {
-        void create(const sf::Vector2f& position) noexcept;
+        void create(sf::Vector2f position) noexcept;
+        void updateAll() noexcept;
     
         namespace Helper
         {
@@ -30,7 +38,8 @@ namespace Enemy
 
     namespace Spiny
     {
-        void create(const sf::Vector2f& position) noexcept;
+        void create(sf::Vector2f position) noexcept;
+        void updateAll() noexcept;
     
         namespace Helper
         {
@@ -42,6 +51,9 @@ namespace Enemy
     namespace Helper
     {
         void setupBaseType(EntityID id, const sf::Vector2f& position, Enum::Type enemy_type) noexcept;
+
+        // what a walking enemy is made of, it has to be there from the creation:
+        // Physics::startAll only moves the entities that already have physics
         void setupComponents(EntityID id) noexcept;
         void standardMovement(EntityID id) noexcept;
     }
@@ -11,13 +11,14 @@ namespace Entity
     // ---------------------------------------------------------- //
     namespace Block
     {
-        void create(const sf::Vector2f& position, Enum::Block block_type, std::optional<Enum::Type> type) noexcept
+        void create(sf::Vector2f position, Enum::Block block_type, std::optional<Enum::Type> type) noexcept
         {
             Block::Helper::errorCheck(block_type, type);
 
             EntityID currentID = Manager::create("assets/block.png");
             
-            System::Base::getSprite(currentID).setPosition(position);
+            System::Base::setPosition(currentID, position);
+            System::Base::setStatic(currentID);
             System::Type::setType(currentID, Enum::Type::BLOCK);
             System::Type::setWhatType(currentID, std::make_pair(block_type, 
                                                         type.has_value() ? type.value() : Enum::Type::NONE));
@@ -25,13 +26,46 @@ namespace Entity
             Manager::addComponent<Component::Physics>(currentID);
             System::Physics::setRigidbody(currentID, true);
 
-            Manager::addComponent<Component::GlobalVariables>(currentID);
-            System::GlobalVariables::addAny(currentID); // index 0 - miscellaneous started
+            Manager::addComponent<Component::BlockState>(currentID);
 
             Block::Helper::setupAnimations(currentID, block_type);
-            Block::Helper::setupUpdateFunction(currentID);
         }   
 
+        void updateAll() noexcept
+        {
+            const auto& blocks = System::Activation::getEntities(Enum::Type::BLOCK);
+            for(std::size_t i = 0; i < blocks.size(); i++)
+            {
+                const EntityID id = blocks.entityAt(i);
+
+                if(System::Animation::getStarted(id)) {
+                    auto& block = System::States::getBlock(id);
+                
+                    if(not block.spawned) {
+                        block.spawned = true;
+
+                        // the position is copied into create, creating an
+                        // entity can move the base of the block in its pool
+                        auto& pair = System::Type::getBlockPair(id);
+                        switch(pair.second)
+                        {
+                            case Enum::Type::MUSHROOM:
+                            Entity::Mushroom::create(System::Base::getPosition(id));
+                            break;
+
+                            case Enum::Type::FLOWER:
+                            Entity::Flower::create(System::Base::getPosition(id));
+                            break;
+
+                            // to make the compiler happy
+                            default:
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
         namespace Helper
         {
             void errorCheck(Enum::Block block_type, std::optional<Enum::Type> type)
@@ -61,68 +95,38 @@ namespace Entity
 
             void setupAnimations(EntityID id, Enum::Block type) noexcept
             {
+                // one clip for every kind of block, shared by all of them
+                static const Clips::SetID clips = [] 
+                {
+                    const Clips::SetID set = Clips::createSet();
+
+                    Clips::setClip(set, int(Enum::Block::EMPTY), sf::IntRect(64, 0, 16, 16));
+
+                    Clips::setClip(set, int(Enum::Block::BRICK), {
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(0, 0, 16, 16)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(16, 0, 32, 16)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(32, 0, 48, 16)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(48, 0, 64, 16))
+                    });
+
+                    Clips::setClip(set, int(Enum::Block::QUESTION_MARK), {
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(0, 16, 16, 32)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(16, 16, 32, 32)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(32, 16, 48, 32)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(48, 0, 64, 16))
+                    });
+
+                    return set;
+                }();
+
                 Manager::addComponent<Component::Animation>(id);
-                switch(type) {
-                    case Enum::Block::EMPTY:
-                        System::Animation::setFrames(id, int(Enum::Block::EMPTY), sf::IntRect(64, 0, 16, 16));
-                    break;
-
-                    case Enum::Block::BRICK:
-                        System::Animation::setFrames(id, int(Enum::Block::BRICK), {
-                            System::Animation::Helper::extractTextureRect(sf::IntRect(0, 0, 16, 16)),
-                            System::Animation::Helper::extractTextureRect(sf::IntRect(16, 0, 32, 16)),
-                            System::Animation::Helper::extractTextureRect(sf::IntRect(32, 0, 48, 16)),
-                            System::Animation::Helper::extractTextureRect(sf::IntRect(48, 0, 64, 16))
-                        });
-                    break;
-
-                    case Enum::Block::QUESTION_MARK:
-                        System::Animation::setFrames(id, int(Enum::Block::QUESTION_MARK), {
-                            System::Animation::Helper::extractTextureRect(sf::IntRect(0, 16, 16, 32)),
-                            System::Animation::Helper::extractTextureRect(sf::IntRect(16, 16, 32, 32)),
-                            System::Animation::Helper::extractTextureRect(sf::IntRect(32, 16, 48, 32)),
-                            System::Animation::Helper::extractTextureRect(sf::IntRect(48, 0, 64, 16))
-                        });
-                    break;
-                }
+                System::Animation::setClips(id, clips);
                 
                 System::Animation::setCurrentAnimation(id, int(type));
                 System::Animation::setNextAnimationTimer(id, 100);
                 System::Animation::setStopWhenFinished(id, true);
                 System::Animation::setAllowPlay(id, false);
             }
-
-            void setupUpdateFunction(EntityID id) noexcept
-            {
-                Manager::addComponent<Component::UpdateFunction>(id);
-                Component::updates[id] = [](EntityID update_id) -> void {
-                    System::Animation::play(update_id);
-
-                    if(System::Animation::getStarted(update_id)) {
-                        System::GlobalVariables::setAnyOnce(update_id, true, 0);
-                    
-                        if(System::GlobalVariables::getLastAny<bool>(update_id)) {
-                            System::GlobalVariables::setAny(update_id, false, 0);
-
-                            auto& pair = System::Type::getBlockPair(update_id);
-                            switch(pair.second)
-                            {
-                                case Enum::Type::MUSHROOM:
-                                Entity::Mushroom::create(System::Base::getSprite(update_id).getPosition());
-                                break;
-
-                                case Enum::Type::FLOWER:
-                                Entity::Flower::create(System::Base::getSprite(update_id).getPosition());
-                                break;
-
-                                // to make the compiler happy
-                                default:
-                                break;
-                            }
-                        }
-                    }
-                };
-            }
         } // namespace Helper
     } // namespace Block
 
@@ -132,11 +136,12 @@ namespace Entity
     // ---------------------------------------------------------- //
     namespace Cloud 
     {
-        void create(const sf::Vector2f& position) noexcept
+        void create(sf::Vector2f position) noexcept
         {   
             EntityID currentID = Manager::create("assets/cloud.png");
 
-            System::Base::getSprite(currentID).setPosition(position);
+            System::Base::setPosition(currentID, position);
+            System::Base::setStatic(currentID);
             System::Type::setType(currentID, Enum::Type::CLOUD);
         }
     } // namespace Cloud
@@ -147,46 +152,46 @@ namespace Entity
     // ---------------------------------------------------------- //
     namespace Coin 
     {
-        void create(const sf::Vector2f& position) noexcept
+        void create(sf::Vector2f position) noexcept
         {   
             EntityID currentID = Manager::create("assets/coin.png");
 
-            System::Base::getSprite(currentID).setPosition(position);
+            System::Base::setPosition(currentID, position);
+            System::Base::setStatic(currentID);
             System::Type::setType(currentID, Enum::Type::COIN);
 
             Coin::Helper::setupAnimations(currentID);
-            Coin::Helper::setupUpdateFunction(currentID);
         }
 
         namespace Helper
         {
             void setupAnimations(EntityID id) noexcept
             {
-                Manager::addComponent<Component::Animation>(id);
                 static constexpr int animPos = 0;
-                
-                System::Animation::setFrames(id, animPos, {
-                    sf::IntRect(0, 0, 10, 14),
-                    sf::IntRect(16, 0, 10, 14),
-                    sf::IntRect(32, 0, 10, 14),
-                    sf::IntRect(48, 0, 10, 14),
-                    sf::IntRect(3, 15, 3, 15),
-                    sf::IntRect(17, 15, 7, 15),
-                    sf::IntRect(35, 15, 4, 16),
-                    sf::IntRect(53, 15, 1, 16)
-                });
+
+                static const Clips::SetID clips = [] 
+                {
+                    const Clips::SetID set = Clips::createSet();
+                    Clips::setClip(set, animPos, {
+                        sf::IntRect(0, 0, 10, 14),
+                        sf::IntRect(16, 0, 10, 14),
+                        sf::IntRect(32, 0, 10, 14),
+                        sf::IntRect(48, 0, 10, 14),
+                        sf::IntRect(3, 15, 3, 15),
+                        sf::IntRect(17, 15, 7, 15),
+                        sf::IntRect(35, 15, 4, 16),
+                        sf::IntRect(53, 15, 1, 16)
+                    });
+
+                    return set;
+                }();
+
+                Manager::addComponent<Component::Animation>(id);
+                System::Animation::setClips(id, clips);
 
                 System::Animation::setNextAnimationTimer(id, 100);
                 System::Animation::setCurrentAnimation(id, animPos);
             }
-
-            void setupUpdateFunction(EntityID id) noexcept
-            {
-                Manager::addComponent<Component::UpdateFunction>(id);
-                Component::updates[id] = [](EntityID update_id) -> void {
-                    System::Animation::play(update_id);
-                };
-            }
         } // namespace Helper
     } // namespace Coin
 
@@ -195,46 +200,44 @@ namespace Entity
     // ---------------------------------------------------------- //
     namespace Mushroom
     {
-        void create(const sf::Vector2f& position) noexcept
+        void create(sf::Vector2f position) noexcept
         {
             EntityID currentID = Manager::create("assets/mushroom.png");
 
-            System::Base::getSprite(currentID).setPosition(position);
+            System::Base::setPosition(currentID, position);
             System::Type::setType(currentID, Enum::Type::MUSHROOM);
 
             Manager::addComponent<Component::Movement>(currentID);
             Manager::addComponent<Component::Physics>(currentID);
 
-            Manager::addComponent<Component::GlobalVariables>(currentID);
-            System::GlobalVariables::addAny(currentID, true); // index 0 - Jumped
-            System::GlobalVariables::addAny(currentID, false); // index 1 - moveLeft
+            Manager::addComponent<Component::PopOutState>(currentID);
+            Manager::addComponent<Component::WalkerState>(currentID);
+            System::States::getWalker(currentID).moveLeft = false;
 
             System::Physics::setSpeed(currentID, POP_OUT_MUSHROOM_SPEED);
-
-            Mushroom::Helper::setupUpdateFunction(currentID);
         }
 
-        namespace Helper
+        void updateAll() noexcept
         {
-            void setupUpdateFunction(EntityID id) noexcept
+            const auto& mushrooms = System::Activation::getEntities(Enum::Type::MUSHROOM);
+            for(std::size_t i = 0; i < mushrooms.size(); i++)
             {
-                Manager::addComponent<Component::UpdateFunction>(id);
-                Component::updates[id] = [](EntityID update_id) -> void
-                {
-                    System::Physics::start(update_id);
-
-                    Helper::jumpOutOnce(update_id);
-                    Helper::checkBlockedDirections(update_id);
-                    Helper::movement(update_id);
-                };
+                const EntityID id = mushrooms.entityAt(i);
+                Helper::jumpOutOnce(id);
+                Helper::checkBlockedDirections(id);
+                Helper::movement(id);
             }
+        }
 
+        namespace Helper
+        {
             void jumpOutOnce(EntityID id) noexcept
             {
-                if(System::GlobalVariables::getAny<bool>(id, 0)) 
+                auto& popOut = System::States::getPopOut(id);
+                if(popOut.jumpOut) 
                 {
                     System::Movement::jump(id, 100, FORCE::TRUE);
-                    System::GlobalVariables::setAny(id, false, 0);
+                    popOut.jumpOut = false;
                 }
             }
 
@@ -242,17 +245,16 @@ namespace Entity
             {
                 const auto blockedDirection = System::Movement::getBlockedDirection(id);
                 if(blockedDirection == Enum::Direction::RIGHT) {
-                    System::GlobalVariables::setAny(id, false, 1);
+                    System::States::getWalker(id).moveLeft = false;
                 } 
                 else if(blockedDirection == Enum::Direction::LEFT) {
-                    System::GlobalVariables::setAny(id, true, 1);
+                    System::States::getWalker(id).moveLeft = true;
                 }
             }
 
             void movement(EntityID id) noexcept
             {
-                const bool moveLeft = System::GlobalVariables::getAny<bool>(id, 1);
-                if(moveLeft) {
+                if(System::States::getWalker(id).moveLeft) {
                     System::Movement::moveLeft(id, ENEMY_SPEED);
                 } 
                 else {
@@ -267,41 +269,39 @@ namespace Entity
     // ---------------------------------------------------------- //
     namespace Flower
     {
-        void create(const sf::Vector2f& position) noexcept
+        void create(sf::Vector2f position) noexcept
         {
             EntityID currentID = Manager::create("assets/flower.png");
 
-            System::Base::getSprite(currentID).setPosition(position);
+            System::Base::setPosition(currentID, position);
             System::Type::setType(currentID, Enum::Type::FLOWER);
 
             Manager::addComponent<Component::Movement>(currentID);
             Manager::addComponent<Component::Physics>(currentID);
-            Manager::addComponent<Component::GlobalVariables>(currentID);
-            System::GlobalVariables::addAny(currentID, true); // index 0 - Jumped
+            Manager::addComponent<Component::PopOutState>(currentID);
 
             System::Physics::setSpeed(currentID, POP_OUT_FLOWER_SPEED);
-
-            Flower::Helper::setupUpdateFunction(currentID);
         }
 
-        namespace Helper
+        void updateAll() noexcept
         {
-            void setupUpdateFunction(EntityID id) noexcept
+            const auto& flowers = System::Activation::getEntities(Enum::Type::FLOWER);
+            for(std::size_t i = 0; i < flowers.size(); i++)
             {
-                Manager::addComponent<Component::UpdateFunction>(id);
-                Component::updates[id] = [](EntityID update_id) -> void
-                {
-                    System::Physics::start(update_id);
-                    Helper::jumpOutOnce(update_id);
-                };
+                const EntityID id = flowers.entityAt(i);
+                Helper::jumpOutOnce(id);
             }
+        }
 
+        namespace Helper
+        {
             void jumpOutOnce(EntityID id) noexcept
             {
-                if(System::GlobalVariables::getAny<bool>(id, 0)) 
+                auto& popOut = System::States::getPopOut(id);
+                if(popOut.jumpOut) 
                 {
                     System::Movement::jump(id, 100, FORCE::TRUE);
-                    System::GlobalVariables::setAny(id, false, 0);
+                    popOut.jumpOut = false;
                 }
             }
         } // namespace Helper
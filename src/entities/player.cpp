@@ -5,17 +5,20 @@
 #include "../engine/helpers/functions.hpp"
 #include "../engine/helpers/values.hpp"
 #include "../engine/components.hpp"
+#include "../engine/textures.hpp"
+#include "../engine/input.hpp"
+#include "../engine/timers.hpp"
 #include "enemies.hpp"
 
 namespace Entity 
 {
     namespace Player 
     {
-        void create(const sf::Vector2f& position, Enum::Mature maturity) noexcept
+        EntityID create(sf::Vector2f position, Enum::Mature maturity) noexcept
         {
             EntityID currentID = Manager::create("assets/mario.png");
 
-            System::Base::getSprite(currentID).setPosition(position);
+            System::Base::setPosition(currentID, position);
             System::Base::setState(currentID, Enum::State::ALIVE);
             System::Type::setType(currentID, Enum::Type::MARIO);
             System::Type::setWhatType(currentID, maturity);
@@ -23,151 +26,162 @@ namespace Entity
             Player::Helper::setupAnimation(currentID);
             Manager::addComponent<Component::Movement>(currentID);
             Manager::addComponent<Component::Physics>(currentID);
-            Manager::addComponent<Component::GlobalVariables>(currentID);
-            Player::Helper::setupUpdateFunction(currentID);
+            Manager::addComponent<Component::PlayerState>(currentID);
+
+            return currentID;
         }
 
-        namespace Helper
+        void updateAll() noexcept
         {
-            void setupAnimation(EntityID id) noexcept
+            const auto& players = System::Activation::getEntities(Enum::Type::MARIO);
+            for(std::size_t i = 0; i < players.size(); i++)
             {
-                Manager::addComponent<Component::Animation>(id);
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::IDLE_RIGHT, Enum::Mature::CHILD), 
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(133, 99, 145, 114)));
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::IDLE_LEFT, Enum::Mature::CHILD), 
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(83, 99, 95, 114)));
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::WALK_RIGHT, Enum::Mature::CHILD), {
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(148, 99, 160, 114)),
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(163, 98, 177, 114))
-                });
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::WALK_LEFT, Enum::Mature::CHILD), {
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(68, 99, 80, 114)),
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(50, 98, 65, 114))
-                });
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::RUN_RIGHT, Enum::Mature::CHILD), {
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(148, 99, 160, 114)),
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(163, 98, 177, 114))
-                });
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::RUN_LEFT, Enum::Mature::CHILD), {
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(68, 99, 80, 114)),
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(50, 98, 65, 114))
-                });
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::RUN_LEFT, Enum::Mature::CHILD), {
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(68, 99, 80, 114)),
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(50, 98, 65, 114))
-                });
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::JUMP_RIGHT, Enum::Mature::CHILD), 
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(180, 98, 196, 114)));
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::JUMP_LEFT, Enum::Mature::CHILD), 
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(32, 98, 48, 114)));
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::IDLE_RIGHT, Enum::Mature::TEENAGE), 
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(116, 3, 130, 34)));
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::IDLE_LEFT, Enum::Mature::TEENAGE), 
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(100, 3, 114, 33)));
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::WALK_RIGHT, Enum::Mature::TEENAGE), {
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(136, 4, 152, 34)),
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(156, 5, 172, 34))
-                });
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::WALK_LEFT, Enum::Mature::TEENAGE), {
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(78, 4, 94, 34)),
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(58, 5, 74, 34))
-                });
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::RUN_RIGHT, Enum::Mature::TEENAGE), {
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(136, 4, 152, 34)),
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(156, 5, 172, 34))
-                });
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::RUN_LEFT, Enum::Mature::TEENAGE), {
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(78, 4, 94, 34)),
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(58, 5, 74, 34))
-                });
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::JUMP_RIGHT, Enum::Mature::TEENAGE), 
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(175, 4, 191, 34)));
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::JUMP_LEFT, Enum::Mature::TEENAGE), 
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(39, 4, 55, 34)));
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::CROUCH_RIGHT, Enum::Mature::TEENAGE), 
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(194, 12, 210, 34)));
-
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::CROUCH_LEFT, Enum::Mature::TEENAGE), 
-                    System::Animation::Helper::extractTextureRect(sf::IntRect(20, 12, 36, 34)));
+                const EntityID id = players.entityAt(i);
+                System::Movement::setMoving(id, false);
 
-                auto& adultIdleRight = System::Animation::getFrames(id, sum<int>(Enum::Animation::IDLE_RIGHT, Enum::Mature::TEENAGE));
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::IDLE_RIGHT, Enum::Mature::ADULT), adultIdleRight);
+                // get the maturity from the optional variant
+                const auto maturity = System::Type::getMaturity(id);
+                const auto lookingDirection = System::Movement::getLookingDirection(id);
 
-                auto& adultIdleLeft = System::Animation::getFrames(id, sum<int>(Enum::Animation::IDLE_LEFT, Enum::Mature::TEENAGE));
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::IDLE_LEFT, Enum::Mature::ADULT), adultIdleLeft);
-
-                auto& adultWalkRight = System::Animation::getFrames(id, sum<int>(Enum::Animation::WALK_RIGHT, Enum::Mature::TEENAGE));
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::WALK_RIGHT, Enum::Mature::ADULT), adultWalkRight);
-
-                auto& adultWalkLeft = System::Animation::getFrames(id, sum<int>(Enum::Animation::WALK_LEFT, Enum::Mature::TEENAGE));
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::WALK_LEFT, Enum::Mature::ADULT), adultWalkLeft);
-
-                auto& adultRunRight = System::Animation::getFrames(id, sum<int>(Enum::Animation::RUN_RIGHT, Enum::Mature::TEENAGE));
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::RUN_RIGHT, Enum::Mature::ADULT), adultRunRight);
-
-                auto& adultRunLeft = System::Animation::getFrames(id, sum<int>(Enum::Animation::RUN_LEFT, Enum::Mature::TEENAGE));
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::RUN_LEFT, Enum::Mature::ADULT), adultRunLeft);
-
-                auto& adultJumpRight = System::Animation::getFrames(id, sum<int>(Enum::Animation::JUMP_RIGHT, Enum::Mature::TEENAGE));
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::JUMP_RIGHT, Enum::Mature::ADULT), adultJumpRight);
-
-                auto& adultJumpLeft = System::Animation::getFrames(id, sum<int>(Enum::Animation::JUMP_LEFT, Enum::Mature::TEENAGE));
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::JUMP_LEFT, Enum::Mature::ADULT), adultJumpLeft);
+                Player::Helper::startMovement(id, maturity, lookingDirection);
+                Player::Helper::checkTexture(id, maturity);
+            }
+        }
 
-                auto& adultCrouchRight = System::Animation::getFrames(id, sum<int>(Enum::Animation::CROUCH_RIGHT, Enum::Mature::TEENAGE));
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::CROUCH_RIGHT, Enum::Mature::ADULT), adultCrouchRight);
+        namespace Helper
+        {
+            void setupAnimation(EntityID id) noexcept
+            {
+                static const Clips::SetID clips = [] 
+                {
+                    const Clips::SetID set = Clips::createSet();
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::IDLE_RIGHT, Enum::Mature::CHILD), 
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(133, 99, 145, 114)));
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::IDLE_LEFT, Enum::Mature::CHILD), 
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(83, 99, 95, 114)));
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::WALK_RIGHT, Enum::Mature::CHILD), {
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(148, 99, 160, 114)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(163, 98, 177, 114))
+                    });
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::WALK_LEFT, Enum::Mature::CHILD), {
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(68, 99, 80, 114)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(50, 98, 65, 114))
+                    });
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::RUN_RIGHT, Enum::Mature::CHILD), {
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(148, 99, 160, 114)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(163, 98, 177, 114))
+                    });
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::RUN_LEFT, Enum::Mature::CHILD), {
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(68, 99, 80, 114)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(50, 98, 65, 114))
+                    });
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::RUN_LEFT, Enum::Mature::CHILD), {
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(68, 99, 80, 114)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(50, 98, 65, 114))
+                    });
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::JUMP_RIGHT, Enum::Mature::CHILD), 
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(180, 98, 196, 114)));
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::JUMP_LEFT, Enum::Mature::CHILD), 
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(32, 98, 48, 114)));
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::IDLE_RIGHT, Enum::Mature::TEENAGE), 
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(116, 3, 130, 34)));
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::IDLE_LEFT, Enum::Mature::TEENAGE), 
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(100, 3, 114, 33)));
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::WALK_RIGHT, Enum::Mature::TEENAGE), {
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(136, 4, 152, 34)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(156, 5, 172, 34))
+                    });
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::WALK_LEFT, Enum::Mature::TEENAGE), {
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(78, 4, 94, 34)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(58, 5, 74, 34))
+                    });
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::RUN_RIGHT, Enum::Mature::TEENAGE), {
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(136, 4, 152, 34)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(156, 5, 172, 34))
+                    });
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::RUN_LEFT, Enum::Mature::TEENAGE), {
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(78, 4, 94, 34)),
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(58, 5, 74, 34))
+                    });
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::JUMP_RIGHT, Enum::Mature::TEENAGE), 
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(175, 4, 191, 34)));
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::JUMP_LEFT, Enum::Mature::TEENAGE), 
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(39, 4, 55, 34)));
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::CROUCH_RIGHT, Enum::Mature::TEENAGE), 
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(194, 12, 210, 34)));
+
+                    Clips::setClip(set, sum<int>(Enum::Animation::CROUCH_LEFT, Enum::Mature::TEENAGE), 
+                        System::Animation::Helper::extractTextureRect(sf::IntRect(20, 12, 36, 34)));
+
+                    // an adult looks like a teenager with another texture, so they share the same clips
+                    const auto shareWithAdult = [set](Enum::Animation anim) {
+                        Clips::setClip(set, sum<int>(anim, Enum::Mature::ADULT), Clips::getClip(set, sum<int>(anim, Enum::Mature::TEENAGE)));
+                    };
+
+                    shareWithAdult(Enum::Animation::IDLE_RIGHT);
+                    shareWithAdult(Enum::Animation::IDLE_LEFT);
+                    shareWithAdult(Enum::Animation::WALK_RIGHT);
+                    shareWithAdult(Enum::Animation::WALK_LEFT);
+                    shareWithAdult(Enum::Animation::RUN_RIGHT);
+                    shareWithAdult(Enum::Animation::RUN_LEFT);
+                    shareWithAdult(Enum::Animation::JUMP_RIGHT);
+                    shareWithAdult(Enum::Animation::JUMP_LEFT);
+                    shareWithAdult(Enum::Animation::CROUCH_RIGHT);
+                    shareWithAdult(Enum::Animation::CROUCH_LEFT);
+
+                    return set;
+                }();
 
-                auto& adultCrouchLeft = System::Animation::getFrames(id, sum<int>(Enum::Animation::CROUCH_LEFT, Enum::Mature::TEENAGE));
-                System::Animation::setFrames(id, sum<int>(Enum::Animation::CROUCH_LEFT, Enum::Mature::ADULT), adultCrouchLeft);
+                Manager::addComponent<Component::Animation>(id);
+                System::Animation::setClips(id, clips);
 
                 System::Animation::setAllowPlay(id, true);
             }
 
-            void setupUpdateFunction(EntityID id) noexcept
+            void checkTexture(EntityID id, Enum::Mature maturity) noexcept
             {
-                Manager::addComponent<Component::UpdateFunction>(id);
-                Component::updates[id] = [](EntityID update_id) -> void
-                {
-                    static const sf::Texture defaultTexture = *System::Base::getSprite(update_id).getTexture();
-                    static const sf::Texture whiteTexture   = changeMarioRednessColor(*System::Base::getSprite(update_id).getTexture(), sf::Color(255, 250, 250));
-
-                    System::Movement::setMoving(update_id, false);
-
-                    System::Physics::start(update_id);
+                // there are no textures without a window
+                if(Textures::isHeadless()) {
+                    return;
+                }
 
-                    // get the maturity from the optional variant
-                    const auto maturity = System::Type::getMaturity(update_id);
-                    const auto lookingDirection = System::Movement::getLookingDirection(update_id);
+                // getSprite marks the bounds as dirty, so it's not touched every tick
+                auto& player = System::States::getPlayer(id);
+                if(player.texturedAs == maturity) {
+                    return;
+                }
+                player.texturedAs = maturity;
 
-                    Player::Helper::startMovement(update_id, maturity, lookingDirection);
+                sf::Sprite& sprite = System::Base::getSprite(id);
 
-                    if(maturity == Enum::Mature::ADULT) {
-                        System::Base::getSprite(update_id).setTexture(whiteTexture);
-                    } 
-                    else {
-                        System::Base::getSprite(update_id).setTexture(defaultTexture);
-                    }
+                static const sf::Texture& defaultTexture = *sprite.getTexture();
+                static const sf::Texture& whiteTexture   = Textures::get(Textures::insert("assets/mario.png:white", 
+                                                                changeMarioRednessColor(defaultTexture, sf::Color(255, 250, 250))));
 
-                    System::Animation::play(update_id);
-                };
+                if(maturity == Enum::Mature::ADULT) {
+                    sprite.setTexture(whiteTexture);
+                } 
+                else {
+                    sprite.setTexture(defaultTexture);
+                }
             }
 
             void startMovement(EntityID id, Enum::Mature maturity, Enum::Direction looking_direction)
@@ -185,7 +199,7 @@ namespace Entity
             
             void checkJump(EntityID id, Enum::Mature maturity, Enum::Direction looking_direction) noexcept
             {
-                if(sf::Keyboard::isKeyPressed(sf::Keyboard::Space)) 
+                if(Input::isKeyPressed(sf::Keyboard::Space)) 
                 {
                     System::Movement::jump(id, PLAYER_JUMP, FORCE::FALSE);
                     if(System::Movement::getJumping(id) == true)
@@ -212,15 +226,17 @@ namespace Entity
             {
                 if(maturity == Enum::Mature::ADULT)
                 {
-                    auto& clock = System::GlobalVariables::getClock(id);
-                    if(sf::Time timer = clock.getElapsedTime();
-                        timer >= sf::milliseconds(PLAYER_FIRE))
+                    auto& player = System::States::getPlayer(id);
+                    if(player.canShoot && Input::isKeyPressed(sf::Keyboard::LControl)) 
                     {
-                        if(sf::Keyboard::isKeyPressed(sf::Keyboard::LControl)) 
+                        // the cooldown only starts when there was a free fire to shoot
+                        const Enum::Direction dir = System::Movement::getLookingDirection(id);
+                        if(Enemy::Fire::create(System::Base::getPosition(id), dir))
                         {
-                            const Enum::Direction dir = System::Movement::getLookingDirection(id);
-                            Enemy::Fire::create(System::Base::getSprite(id).getPosition(), id, dir);
-                            clock.restart();
+                            player.canShoot = false;
+                            Timers::schedule(id, millisecondsToTicks(PLAYER_FIRE), [](EntityID shooter) {
+                                System::States::getPlayer(shooter).canShoot = true;
+                            });
                         }
                     }
                 }
@@ -228,7 +244,7 @@ namespace Entity
 
             bool checkCrouch(EntityID id, Enum::Mature maturity, Enum::Direction looking_direction) noexcept
             {
-                if(sf::Keyboard::isKeyPressed(sf::Keyboard::Down))
+                if(Input::isKeyPressed(sf::Keyboard::Down))
                 {
                     if(maturity != Enum::Mature::CHILD)
                     {
@@ -256,7 +272,7 @@ namespace Entity
 
             bool checkMovementRight(EntityID id, float speed, Enum::Mature maturity, Enum::Direction looking_direction) noexcept
             {
-                if(sf::Keyboard::isKeyPressed(sf::Keyboard::Right) && 
+                if(Input::isKeyPressed(sf::Keyboard::Right) && 
                    System::Movement::getBlockedDirection(id) != Enum::Direction::LEFT) /* make sure the player is not touching the 
                                                                                         the left side of the object to prevent overlapping */ 
                 {
@@ -295,7 +311,7 @@ namespace Entity
 
             bool checkMovementLeft(EntityID id, float speed, Enum::Mature maturity, Enum::Direction looking_direction) noexcept
             {
-                if(sf::Keyboard::isKeyPressed(sf::Keyboard::Left) && 
+                if(Input::isKeyPressed(sf::Keyboard::Left) && 
                     System::Movement::getBlockedDirection(id) != Enum::Direction::RIGHT) /* make sure the player is not touching the 
                                                                                             the right side of the object to prevent overlapping*/ 
                 {
@@ -362,7 +378,7 @@ namespace Entity
             float checkSpeed() noexcept
             {
                 // if shift is been pressed change the `speed` to running
-                return sf::Keyboard::isKeyPressed(sf::Keyboard::LShift) ? SHIFTING_PLAYER_SPEED : PLAYER_SPEED;
+                return Input::isKeyPressed(sf::Keyboard::LShift) ? SHIFTING_PLAYER_SPEED : PLAYER_SPEED;
             }
 
             bool checkPlayerRunning(float speed) noexcept
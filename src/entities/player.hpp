@@ -9,12 +9,13 @@ namespace Entity
 {
     namespace Player 
     {
-        void create(const sf::Vector2f& position, Enum::Mature maturity) noexcept;
+        EntityID create(sf::Vector2f position, Enum::Mature maturity) noexcept;
+        void updateAll() noexcept;
     
         namespace Helper 
         {
             void setupAnimation(EntityID id) noexcept;
-            void setupUpdateFunction(EntityID id) noexcept;
+            void checkTexture(EntityID id, Enum::Mature maturity) noexcept;
             
             void startMovement(EntityID id, Enum::Mature maturity, Enum::Direction looking_direction);   
             void checkJump(EntityID id, Enum::Mature maturity, Enum::Direction looking_direction) noexcept;
@@ -1,16 +1,47 @@
 #include "game.hpp"
 #include "engine/manager.hpp"
+#include "engine/debug.hpp"
+#include "engine/textures.hpp"
+#include "engine/input.hpp"
+#include "engine/jobs.hpp"
 
 #include "entities/entities.hpp"
 #include "entities/player.hpp"
 #include "entities/enemies.hpp"
 
+#include "engine/helpers/values.hpp"
+
+#include <algorithm>
 #include <iostream>
 
-Game::Game() 
-	: render(Window::window)
+Game::Game(HEADLESS headless) 
+	: Window(headless)
 {
-	Entity::Player::create(sf::Vector2f(180, 50), Enum::Mature::CHILD); // index 0
+	if(bool(headless)) 
+	{
+		Textures::setHeadless(true);
+		Input::setSource(Input::nothing);
+	}
+	else {
+		render.emplace(*Window::window);
+	}
+
+	Jobs::start();
+
+	System::Game::addSystem(Enum::Type::MARIO,    Entity::Player::updateAll);
+	System::Game::addSystem(Enum::Type::BLOCK,    Entity::Block::updateAll);
+	System::Game::addSystem(Enum::Type::MUSHROOM, Entity::Mushroom::updateAll);
+	System::Game::addSystem(Enum::Type::FLOWER,   Entity::Flower::updateAll);
+	System::Game::addSystem(Enum::Type::FIRE,     Enemy::Fire::updateAll);
+	System::Game::addSystem(Enum::Type::GOOMBA,   Enemy::Goomba::updateAll);
+	System::Game::addSystem(Enum::Type::SPINY,    Enemy::Spiny::updateAll);
+
+	System::Game::setRecycler(Enum::Type::FIRE, Enemy::Fire::Helper::recycle);
+
+	playerID = Entity::Player::create(sf::Vector2f(180, 50), Enum::Mature::CHILD);
+
+	// the camera follows it, so it's never parked
+	System::Activation::keepActive(playerID);
 	Entity::Coin::create(sf::Vector2f(300, 160));
 
 	for(size_t i = 1; i < 20; i++) {
@@ -22,19 +53,92 @@ Game::Game()
 	Entity::Block::create(sf::Vector2f(180, 205), Enum::Block::EMPTY, std::nullopt);
 	Enemy::Goomba::create(sf::Vector2f(350, 50));
 	Enemy::Spiny::create(sf::Vector2f(300, 50));
+
+	// after the level, so firing never creates entities
+	Enemy::Fire::createPool();
 }
 
 bool Game::run() noexcept {
-	while (window.isOpen()) {
-		Window::eventHandler();
-		Window::clear();
+	const sf::Time tickTime = sf::seconds(1.f / TICKS_PER_SECOND);
 
-		render.drawAll();
-		System::Game::updateAll();
+	sf::Clock frameClock;
+	sf::Time lag = sf::Time::Zero;
+
+	while (window && window->isOpen()) {
+		{
+			PROFILE_SCOPE(Profiler::Section::EVENTS);
+			Window::eventHandler();
+		}
+
+		lag += frameClock.restart();
+		lag = std::min(lag, tickTime * float(MAX_TICKS_PER_FRAME));
+
+		{
+			#ifdef ENABLE_DEBUG_MODE
+			const Debug::FrameAllocationCheck allocationCheck(&*render);
+			#endif
+
+			while(lag >= tickTime) 
+			{
+				Game::tick();
+				lag -= tickTime;
+			}
+
+			const float interpolation = lag / tickTime;
+
+			Window::clear();
+			Window::interpolateCamera(interpolation);
+
+			PROFILE_SCOPE(Profiler::Section::RENDER);
+			render->drawAll(interpolation);
+		}
+
+		// the overlay is rebuilding its text from time to time,
+		// so it's outside of the allocation check
+		#ifdef ENABLE_DEBUG_MODE
+		Profiler::endFrame();
+		profilerOverlay.draw(*Window::window);
+		#endif
 
-		Window::updateCamera(/*player_id*/0);
 		Window::display();
 	}
 
 	return EXIT_SUCCESS;
+}
+
+bool Game::runHeadless(unsigned long ticks) noexcept {
+	for(unsigned long i = 0; i < ticks; i++) 
+	{
+		Game::tick();
+
+		#ifdef ENABLE_DEBUG_MODE
+		Profiler::endFrame();
+		#endif
+	}
+
+	#ifdef ENABLE_DEBUG_MODE
+	Profiler::print(std::cout);
+	#endif
+
+	return EXIT_SUCCESS;
+}
+
+void Game::tick() noexcept {
+	System::Base::savePreviousPositions();
+	Window::saveCamera();
+
+	// the entities far away from the camera are parked
+	System::Activation::setRegion(sf::FloatRect(view.getCenter() - view.getSize() / 2.f, view.getSize()));
+
+	{
+		PROFILE_SCOPE(Profiler::Section::UPDATE);
+		System::Game::updateAll();
+	}
+
+	PROFILE_SCOPE(Profiler::Section::CAMERA);
+	Window::updateCamera(playerID);
+}
+
+EntityID Game::getPlayerID() const noexcept {
+	return playerID;
 }
\ No newline at end of file
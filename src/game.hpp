@@ -3,16 +3,35 @@
 
 #include <SFML/Graphics.hpp>
 
+#include <optional>
+
 #include "engine/window.hpp"
 #include "engine/system.hpp"
+#include "engine/profiler.hpp"
+#include "engine/helpers/enums.hpp"
 
 class Game : private Window {
 public:
-	Game();
+	// headless: no window, no GPU textures and no keyboard,
+	// the input can be injected through Input::setSource
+	explicit Game(HEADLESS headless = HEADLESS::FALSE);
 	bool run() noexcept;
 
+	// runs `ticks` ticks as fast as possible, without rendering
+	bool runHeadless(unsigned long ticks) noexcept;
+
+	// advances the simulation by one fixed step, without rendering
+	void tick() noexcept;
+
+	EntityID getPlayerID() const noexcept;
+
 private:
-	System::Render render;
+	std::optional<System::Render> render;
+	EntityID playerID;
+
+	#ifdef ENABLE_DEBUG_MODE
+	Profiler::Overlay profilerOverlay;
+	#endif
 };
 
 #endif
\ No newline at end of file
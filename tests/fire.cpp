@@ -0,0 +1,58 @@
+// ---------------------------------------------------------- //
+// A fireball that was just shot must still be flying after
+// the tick it was shot in, and the ones after it.
+// run it from the bin folder (it needs the assets)
+// ---------------------------------------------------------- //
+#include <SFML/Graphics.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "../src/game.hpp"
+#include "../src/engine/input.hpp"
+#include "../src/engine/system.hpp"
+#include "../src/engine/components.hpp"
+
+namespace
+{
+    constexpr unsigned int TICKS = 10;
+
+    bool shooting(sf::Keyboard::Key key) noexcept {
+        return key == sf::Keyboard::LControl;
+    }
+
+    std::size_t countFires() noexcept {
+        return Component::typeMembers[std::size_t(Enum::Type::FIRE)].size();
+    }
+} // namespace
+
+int main()
+{
+    Game game(HEADLESS::TRUE);
+
+    // only the adult one can shoot
+    System::Type::setWhatType(game.getPlayerID(), Enum::Mature::ADULT);
+    Input::setSource(shooting);
+
+    game.tick();
+    if(countFires() == 0)
+    {
+        std::printf("FAILED: the fire didn't survive the tick it was shot in\n");
+        return EXIT_FAILURE;
+    }
+
+    // nothing is shot anymore, the first one keeps flying
+    Input::setSource(Input::nothing);
+    for(unsigned int i = 1; i < TICKS; i++)
+    {
+        game.tick();
+        if(countFires() == 0)
+        {
+            std::printf("FAILED: the fire was gone after %u ticks\n", i + 1);
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::printf("passed\n");
+    return EXIT_SUCCESS;
+}